@@ -0,0 +1,70 @@
+/**
+* @file BatchGenerator.cpp
+* @brief Implements the BatchGenerator.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include "BatchGenerator.hpp"
+
+namespace Sudoku{
+	BatchGenerator::BatchGenerator(Difficulty difficulty, bool unique, int thread_count, uint64_t seed)
+		: seed(seed), pool(thread_count)
+	{
+		for(int w=0; w<this->pool.getWorkerCount(); w++)
+			this->generators.emplace_back(new SudokuGenerator(difficulty, unique));
+	}
+
+	int BatchGenerator::getThreadCount() const {
+		return this->pool.getWorkerCount();
+	}
+
+	uint64_t BatchGenerator::getSeed() const {
+		return this->seed;
+	}
+
+	void BatchGenerator::setSolverEngine(SolverEngine engine){
+		for(std::unique_ptr<SudokuGenerator>& generator : this->generators)
+			generator->setSolverEngine(engine);
+	}
+
+	void BatchGenerator::setTargetGrade(Grade grade, int max_attempts){
+		for(std::unique_ptr<SudokuGenerator>& generator : this->generators)
+			generator->setTargetGrade(grade, max_attempts);
+	}
+
+	void BatchGenerator::generate(uint64_t count, const std::function<void(const Board&)>& sink){
+		const uint64_t block_boards = static_cast<uint64_t>(BLOCK_BOARDS) * this->pool.getWorkerCount();
+		std::vector<Board> boards(static_cast<size_t>(std::min(block_boards, count)));
+		for(uint64_t first=0; first<count; first+=block_boards){
+			int board_cnt = static_cast<int>(std::min(block_boards, count - first));
+			this->pool.run(board_cnt, [&](int w, int b){
+				SudokuGenerator& generator = *this->generators[w];
+				generator.setSeed(SudokuGenerator::deriveSeed(this->seed, first + b));
+				boards[b] = Board(); // generation fills the board around its existing values
+				generator.generateBoard(boards[b]);
+			});
+			for(int b=0; b<board_cnt; b++)
+				sink(boards[b]);
+		}
+	}
+
+	void BatchGenerator::generate(uint64_t count, std::ostream& out, FileIO::Format format){
+		if(format == FileIO::BINARY)
+			throw std::invalid_argument("BINARY is not a text format.");
+		this->generate(count, [&](const Board& board){
+			if(format == FileIO::LINE)
+				FileIO::writeLine(out, board);
+			else
+				out << board;
+		});
+	}
+
+	void BatchGenerator::generate(uint64_t count, FileIO::BinaryPuzzleWriter& writer){
+		this->generate(count, [&](const Board& board){
+			writer.write(board);
+		});
+	}
+}
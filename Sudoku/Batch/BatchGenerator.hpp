@@ -0,0 +1,97 @@
+/**
+* @file BatchGenerator.hpp
+* @brief Defines the BatchGenerator class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "../Sudoku/Board.hpp"
+#include "../Generator/SudokuGenerator.hpp"
+#include "../FileIO/FileIO.hpp"
+#include "../FileIO/BinaryFormat.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Generates packs of puzzles on a WorkStealingPool.
+     *
+     * @details The n-th board of a pack is generated by a SudokuGenerator reseeded with SudokuGenerator::deriveSeed(seed, n),
+     * so a pack only depends on the seed, the difficulty and the uniqueness, never on the number of threads.
+     * The boards are generated in blocks and handed out in order after every block, so they can be streamed to a writer
+     * without keeping the whole pack in memory.
+     */
+    class BatchGenerator {
+    public:
+        /**
+         * @brief Constructor.
+         * @param difficulty Difficulty level of the generated boards.
+         * @param unique Indicates if the generated boards must have a unique solution.
+         * @param thread_count The number of threads. 0 uses every hardware thread.
+         * @param seed The seed of the pack.
+         */
+        BatchGenerator(Difficulty difficulty, bool unique, int thread_count, uint64_t seed);
+
+        /**
+         * @brief Getter for the number of threads.
+         * @return The number of threads generate runs on.
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Getter for the seed.
+         * @return The seed of the pack.
+         */
+        uint64_t getSeed() const;
+
+        /**
+         * @brief Sets the engine used for the uniqueness checks of every generator.
+         * @param engine The new uniqueness check engine.
+         */
+        void setSolverEngine(SolverEngine engine);
+
+        /**
+         * @brief Makes every generator aim for boards of the given grade, see SudokuGenerator::setTargetGrade.
+         * @param grade The target grade.
+         * @param max_attempts The maximum number of boards generated per board of the pack.
+         * @throw std::invalid_argument if \p max_attempts is less than 1
+         */
+        void setTargetGrade(Grade grade, int max_attempts = 64);
+
+        /**
+         * @brief Generates \p count boards and passes them to \p sink in order, on the calling thread.
+         * @param count The number of boards.
+         * @param sink Called with every generated board.
+         */
+        void generate(uint64_t count, const std::function<void(const Board&)>& sink);
+
+        /**
+         * @brief Generates \p count boards and writes them to a text stream.
+         * @param count The number of boards.
+         * @param out The stream the boards are written to.
+         * @param format GRID or LINE.
+         * @throw std::invalid_argument if \p format is BINARY
+         */
+        void generate(uint64_t count, std::ostream& out, FileIO::Format format);
+
+        /**
+         * @brief Generates \p count boards and appends them to a binary puzzle file.
+         * @param count The number of boards.
+         * @param writer The writer of the binary file.
+         */
+        void generate(uint64_t count, FileIO::BinaryPuzzleWriter& writer);
+
+    private:
+        static const int BLOCK_BOARDS = 16; /**< Boards per worker in one block. */
+
+        uint64_t seed; /**< The seed of the pack. */
+        std::vector<std::unique_ptr<SudokuGenerator>> generators; /**< One generator per worker. */
+        WorkStealingPool pool; /**< Runs the boards of a block. */
+    };
+}
@@ -0,0 +1,155 @@
+/**
+* @file BatchSolver.cpp
+* @brief Implements the BatchSolver.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <mutex>
+#include "BatchSolver.hpp"
+#include "../FileIO/FileIO.hpp"
+#include "../Constants.hpp"
+
+using Constants::BOARD_SIZE;
+
+namespace Sudoku{
+	BatchSolver::BatchSolver() : BatchSolver(BACKTRACKING, 1, true) {}
+
+	BatchSolver::BatchSolver(SolverEngine engine) : BatchSolver(engine, 1, true) {}
+
+	BatchSolver::BatchSolver(SolverEngine engine, int thread_count, bool ordered)
+		: engine(engine), ordered(ordered), pool(thread_count)
+	{
+		for(int w=0; w<this->pool.getWorkerCount(); w++){
+			this->workers.emplace_back(new Worker());
+			this->workers.back()->solver.setEngine(engine);
+		}
+	}
+
+	int BatchSolver::getThreadCount() const {
+		return this->pool.getWorkerCount();
+	}
+
+	void BatchSolver::setCacheCapacity(size_t capacity){
+		this->cache.reset(capacity > 0 ? new SolutionCache(capacity) : nullptr);
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->solver.setSolutionCache(this->cache.get());
+	}
+
+	BatchResult BatchSolver::solve(std::istream& in, std::ostream& out){
+		// the lines of a block point into these strings, which are only overwritten by the next block
+		std::vector<std::string> storage;
+		return this->solveLines([&](std::vector<Line>& lines, int max_lines){
+			if(storage.size() < static_cast<size_t>(max_lines))
+				storage.resize(max_lines);
+			int line_cnt = 0;
+			while(line_cnt < max_lines && std::getline(in, storage[line_cnt])){
+				lines[line_cnt].data = storage[line_cnt].data();
+				lines[line_cnt].length = storage[line_cnt].size();
+				line_cnt++;
+			}
+			return line_cnt;
+		}, out);
+	}
+
+	BatchResult BatchSolver::solve(FileIO::MappedPuzzleReader& reader, std::ostream& out){
+		return this->solveLines([&](std::vector<Line>& lines, int max_lines){
+			int line_cnt = 0;
+			while(line_cnt < max_lines && reader.nextLine(lines[line_cnt].data, lines[line_cnt].length))
+				line_cnt++;
+			return line_cnt;
+		}, out);
+	}
+
+	BatchResult BatchSolver::solveLines(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out){
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->result = BatchResult();
+		if(this->workers.size() == 1)
+			this->solveSequential(read_block, out);
+		else
+			this->solveParallel(read_block, out);
+
+		BatchResult result;
+		for(const std::unique_ptr<Worker>& worker : this->workers){
+			result.puzzles += worker->result.puzzles;
+			result.solved += worker->result.solved;
+			result.unsolvable += worker->result.unsolvable;
+			result.invalid += worker->result.invalid;
+			result.stats += worker->result.stats;
+		}
+		return result;
+	}
+
+	void BatchSolver::solveLine(Worker& worker, const char* line, size_t length, std::string& output){
+		if(length > 0 && line[length-1] == '\r')
+			length--;
+		if(length == 0){
+			output += '\n';
+			return;
+		}
+		worker.result.puzzles++;
+		try{
+			FileIO::parseLine(line, length, worker.start_board);
+		}
+		catch(const std::invalid_argument&){
+			worker.result.invalid++;
+			output.append(line, length);
+			output += '\n';
+			return;
+		}
+		if(!worker.checker.isValid(worker.start_board)){
+			worker.result.invalid++;
+			output.append(line, length);
+		} else if(!worker.solver.solve(worker.start_board, worker.solution_board, worker.result.stats)){
+			worker.result.unsolvable++;
+			output.append(line, length);
+		} else {
+			worker.result.solved++;
+			for(int i=0; i<BOARD_SIZE; i++)
+				output.append(worker.solution_board[i], BOARD_SIZE);
+		}
+		output += '\n';
+	}
+
+	void BatchSolver::solveSequential(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out){
+		Worker& worker = *this->workers[0];
+		std::vector<Line> lines(1);
+		std::string output;
+		while(read_block(lines, 1)){
+			output.clear();
+			this->solveLine(worker, lines[0].data, lines[0].length, output);
+			out << output;
+		}
+	}
+
+	void BatchSolver::solveParallel(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out){
+		const int block_lines = TASK_LINES * BLOCK_TASKS * this->pool.getWorkerCount();
+		std::vector<Line> lines(block_lines);
+		std::vector<std::string> outputs;
+		std::mutex out_mutex;
+		int line_cnt;
+		while((line_cnt = read_block(lines, block_lines)) > 0){
+			int task_cnt = (line_cnt + TASK_LINES - 1) / TASK_LINES;
+			if(outputs.size() < static_cast<size_t>(task_cnt))
+				outputs.resize(task_cnt);
+			this->pool.run(task_cnt, [&](int w, int t){
+				std::string& output = outputs[t];
+				output.clear();
+				int end = std::min(line_cnt, (t + 1) * TASK_LINES);
+				for(int l=t*TASK_LINES; l<end; l++)
+					this->solveLine(*this->workers[w], lines[l].data, lines[l].length, output);
+				if(!this->ordered){
+					std::lock_guard<std::mutex> lock(out_mutex);
+					out << output;
+				}
+			});
+			if(this->ordered){
+				for(int t=0; t<task_cnt; t++)
+					out << outputs[t];
+			}
+		}
+	}
+}
@@ -0,0 +1,159 @@
+/**
+* @file BatchSolver.hpp
+* @brief Defines the BatchSolver class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <iostream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Sudoku/Board.hpp"
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Solver/SudokuSolver.hpp"
+#include "../Solver/SolutionCache.hpp"
+#include "../Checker/SudokuChecker.hpp"
+#include "../FileIO/MappedPuzzleReader.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Number of puzzles in each outcome of a batch run.
+     */
+    struct BatchResult {
+        long long puzzles = 0; /**< Non-empty input lines. */
+        long long solved = 0; /**< Puzzles written out solved. */
+        long long unsolvable = 0; /**< Puzzles with valid givens but no solution. */
+        long long invalid = 0; /**< Lines that are not a board in the line format or whose givens break the rules. */
+        SolverStats stats; /**< Work of the solver added up over every solved and unsolvable puzzle. */
+    };
+
+    /**
+     * @brief Solves a stream of puzzles written in the FileIO line format, one puzzle per line.
+     *
+     * @details Every input line produces exactly one output line. Solved puzzles are written in the line format,
+     * every other line is copied to the output unchanged.
+     *
+     * With more than one thread the input is read in blocks of lines that are split into tasks of consecutive lines
+     * and solved on a WorkStealingPool. Every worker owns its own solver, checker and boards, so the only state the
+     * workers share is the block they read from. In ordered mode the n-th output line belongs to the n-th input line.
+     * In unordered mode every task is written as soon as it is solved, so the lines of a block can come out in any order
+     * (the lines of a task stay together).
+     */
+    class BatchSolver {
+    public:
+        /**
+         * @brief Default constructor. Solves with the BACKTRACKING engine on a single thread.
+         */
+        BatchSolver();
+
+        /**
+         * @brief Constructor. Solves with the given engine on a single thread.
+         * @param engine The search engine used for every puzzle.
+         */
+        BatchSolver(SolverEngine engine);
+
+        /**
+         * @brief Constructor.
+         * @param engine The search engine used for every puzzle.
+         * @param thread_count The number of threads. 0 uses every hardware thread.
+         * @param ordered Whether the output lines keep the order of the input lines.
+         */
+        BatchSolver(SolverEngine engine, int thread_count, bool ordered);
+
+        /**
+         * @brief Getter for the number of threads.
+         * @return The number of threads solve runs on.
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Makes every worker look the puzzles up in a SolutionCache shared by the threads, see SudokuSolver::setSolutionCache.
+         * @details Worth it for inputs that repeat puzzles, also relabeled, transposed or with swapped rows and columns.
+         * @param capacity The maximum number of cached puzzles, 0 to solve without a cache.
+         */
+        void setCacheCapacity(size_t capacity);
+
+        /**
+         * @brief Solves every puzzle of \p in and writes the results to \p out.
+         * @param in The stream of puzzles.
+         * @param out The stream the solutions are written to.
+         * @return The number of puzzles in each outcome.
+         */
+        BatchResult solve(std::istream& in, std::ostream& out);
+
+        /**
+         * @brief Solves every puzzle of a memory mapped file and writes the results to \p out.
+         * @details The lines are parsed straight from the mapping, without being copied.
+         * @param reader The reader of the puzzle file. It is read from its current position to the end.
+         * @param out The stream the solutions are written to.
+         * @return The number of puzzles in each outcome.
+         */
+        BatchResult solve(FileIO::MappedPuzzleReader& reader, std::ostream& out);
+
+    private:
+        static const int TASK_LINES = 32; /**< Lines solved by one task. */
+        static const int BLOCK_TASKS = 64; /**< Tasks per worker in one block of input. */
+
+        /**
+         * @brief State owned by one worker.
+         */
+        struct Worker {
+            SudokuSolver solver; /**< Solver used for every puzzle of the worker. */
+            SudokuChecker checker; /**< Rejects puzzles whose givens break the rules before they reach the solver. */
+            Board start_board; /**< The puzzle that is being solved. */
+            MarkedBoard solution_board; /**< The solution of the puzzle that is being solved. */
+            BatchResult result; /**< Outcomes of the puzzles solved by the worker. */
+        };
+
+        SolverEngine engine; /**< Search engine used for every puzzle. */
+        bool ordered; /**< Whether the output lines keep the order of the input lines. */
+        std::vector<std::unique_ptr<Worker>> workers; /**< One worker per thread. */
+        std::unique_ptr<SolutionCache> cache; /**< Cache of the solvers of every worker, or nullptr. */
+        WorkStealingPool pool; /**< Runs the tasks of a block when there is more than one worker. */
+
+        /**
+         * @brief A line of the input, without the line terminator.
+         */
+        struct Line {
+            const char* data; /**< First character of the line. */
+            size_t length; /**< Number of characters in the line. */
+        };
+
+        /**
+         * @brief Solves every line returned by \p read_block and writes the results to \p out.
+         * @param read_block Reads up to the given number of lines into the vector and returns how many were read.
+         * The lines must stay valid until the next call.
+         * @param out The stream the solutions are written to.
+         * @return The number of puzzles in each outcome.
+         */
+        BatchResult solveLines(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out);
+
+        /**
+         * @brief Solves one line and appends the output line to \p output.
+         * @param worker The worker that solves the line.
+         * @param line The first character of the input line.
+         * @param length The length of the input line, without the line terminator.
+         * @param output The buffer the output line is appended to.
+         */
+        void solveLine(Worker& worker, const char* line, size_t length, std::string& output);
+
+        /**
+         * @brief Solves the lines on the calling thread, one line at a time.
+         * @param read_block The source of the lines, see solveLines.
+         * @param out The stream the solutions are written to.
+         */
+        void solveSequential(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out);
+
+        /**
+         * @brief Solves the lines block by block on the pool.
+         * @param read_block The source of the lines, see solveLines.
+         * @param out The stream the solutions are written to.
+         */
+        void solveParallel(const std::function<int(std::vector<Line>&, int)>& read_block, std::ostream& out);
+    };
+}
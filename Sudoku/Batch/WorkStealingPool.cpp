@@ -0,0 +1,116 @@
+/**
+* @file WorkStealingPool.cpp
+* @brief Implements the WorkStealingPool.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <thread>
+#include "WorkStealingPool.hpp"
+
+namespace Sudoku{
+	WorkStealingPool::WorkStealingPool(int worker_count) : task_fn(nullptr), run_cnt(0), busy_threads(0), stopping(false) {
+		if(worker_count < 1)
+			worker_count = static_cast<int>(std::thread::hardware_concurrency());
+		if(worker_count < 1) // the hardware concurrency is unknown
+			worker_count = 1;
+		for(int w=0; w<worker_count; w++)
+			this->queues.emplace_back(new TaskQueue());
+		for(int w=1; w<worker_count; w++)
+			this->threads.emplace_back(&WorkStealingPool::threadLoop, this, w);
+	}
+
+	WorkStealingPool::~WorkStealingPool(){
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+		}
+		this->start_cv.notify_all();
+		for(std::thread& thread : this->threads)
+			thread.join();
+	}
+
+	int WorkStealingPool::getWorkerCount() const {
+		return static_cast<int>(this->queues.size());
+	}
+
+	void WorkStealingPool::run(int task_count, const std::function<void(int worker, int task)>& task_fn){
+		int worker_count = this->getWorkerCount();
+		for(int w=0; w<worker_count; w++){
+			std::deque<int>& tasks = this->queues[w]->tasks;
+			tasks.clear();
+			long long begin = static_cast<long long>(task_count) * w / worker_count;
+			long long end = static_cast<long long>(task_count) * (w + 1) / worker_count;
+			// reversed, so the owner takes its range front to back from the back of the deque
+			for(long long t=end-1; t>=begin; t--)
+				tasks.push_back(static_cast<int>(t));
+		}
+		if(this->threads.empty() || task_count < 2){
+			this->work(0, task_fn);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->task_fn = &task_fn;
+			this->busy_threads = static_cast<int>(this->threads.size());
+			this->run_cnt++;
+		}
+		this->start_cv.notify_all();
+		this->work(0, task_fn);
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->done_cv.wait(lock, [this]{ return this->busy_threads == 0; });
+		this->task_fn = nullptr;
+	}
+
+	void WorkStealingPool::threadLoop(int worker){
+		unsigned long long seen_runs = 0;
+		while(true){
+			const std::function<void(int worker, int task)>* task_fn;
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->start_cv.wait(lock, [&]{ return this->stopping || this->run_cnt != seen_runs; });
+				if(this->stopping)
+					return;
+				seen_runs = this->run_cnt;
+				task_fn = this->task_fn;
+			}
+			this->work(worker, *task_fn);
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				if(--this->busy_threads == 0)
+					this->done_cv.notify_one();
+			}
+		}
+	}
+
+	bool WorkStealingPool::nextTask(int worker, int& task){
+		{
+			TaskQueue& own = *this->queues[worker];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if(!own.tasks.empty()){
+				task = own.tasks.back();
+				own.tasks.pop_back();
+				return true;
+			}
+		}
+		// tasks are never added during a run, so one empty sweep over the victims means everything was taken
+		int worker_count = this->getWorkerCount();
+		for(int i=1; i<worker_count; i++){
+			TaskQueue& victim = *this->queues[(worker + i) % worker_count];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if(!victim.tasks.empty()){
+				task = victim.tasks.front();
+				victim.tasks.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void WorkStealingPool::work(int worker, const std::function<void(int worker, int task)>& task_fn){
+		int task;
+		while(this->nextTask(worker, task))
+			task_fn(worker, task);
+	}
+}
@@ -0,0 +1,99 @@
+/**
+* @file WorkStealingPool.hpp
+* @brief Defines the WorkStealingPool class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sudoku {
+    /**
+     * @brief Runs a set of independent tasks on a fixed number of workers with work stealing.
+     *
+     * @details Every worker owns a deque of task indices. The tasks are split into contiguous ranges, one per worker.
+     * A worker takes tasks from the back of its own deque and, once it runs dry, steals from the front of the deques
+     * of the other workers, so workers that drew cheap tasks help the ones that drew expensive ones.
+     * The calling thread is worker 0. The other workers are threads started by the constructor that sleep between runs,
+     * so a run costs a wake-up instead of a thread start and the pool can be used for short runs as well.
+     */
+    class WorkStealingPool {
+    public:
+        /**
+         * @brief Constructor.
+         * @param worker_count The number of workers, including the calling thread. Values below 1 use every hardware thread.
+         */
+        WorkStealingPool(int worker_count);
+
+        /**
+         * @brief Destructor. Stops and joins the worker threads.
+         */
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /**
+         * @brief Getter for the number of workers.
+         * @return The number of workers.
+         */
+        int getWorkerCount() const;
+
+        /**
+         * @brief Calls \p task_fn once for every task in [0, task_count) and waits until all of them return.
+         * @param task_count The number of tasks.
+         * @param task_fn Called with the index of the worker and the index of the task. Calls with the same worker index never overlap.
+         * Must not throw.
+         */
+        void run(int task_count, const std::function<void(int worker, int task)>& task_fn);
+
+    private:
+        /**
+         * @brief Task indices owned by one worker.
+         */
+        struct TaskQueue {
+            std::mutex mutex; /**< Guards tasks against the thieves. */
+            std::deque<int> tasks; /**< Indices of the tasks that have not been taken yet. */
+        };
+
+        std::vector<std::unique_ptr<TaskQueue>> queues; /**< One queue per worker. */
+        std::vector<std::thread> threads; /**< Threads of the workers other than worker 0. */
+
+        std::mutex mutex; /**< Guards the run state below. */
+        std::condition_variable start_cv; /**< Wakes the threads when a run starts or the pool stops. */
+        std::condition_variable done_cv; /**< Wakes run when the last thread finishes its work. */
+        const std::function<void(int worker, int task)>* task_fn; /**< Task function of the current run. */
+        unsigned long long run_cnt; /**< Number of runs started, tells the threads that a new run started. */
+        int busy_threads; /**< Threads still working on the current run. */
+        bool stopping; /**< Set by the destructor. */
+
+        /**
+         * @brief Takes the next task of a worker, stealing one if its own queue is empty.
+         * @param worker The index of the worker.
+         * @param task Set to the index of the taken task.
+         * @return false if no task is left in any queue, true otherwise.
+         */
+        bool nextTask(int worker, int& task);
+
+        /**
+         * @brief Takes tasks until none is left.
+         * @param worker The index of the worker.
+         * @param task_fn The function the tasks are passed to.
+         */
+        void work(int worker, const std::function<void(int worker, int task)>& task_fn);
+
+        /**
+         * @brief Body of a worker thread: waits for runs and works on them until the pool stops.
+         * @param worker The index of the worker.
+         */
+        void threadLoop(int worker);
+    };
+}
@@ -0,0 +1,53 @@
+/**
+ * @file Bits.hpp
+ * @brief Portable bit manipulation helpers used by the bitmask based algorithms.
+ * @author Nikola Jolovic
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Contains portable wrappers around compiler bit manipulation intrinsics.
+ */
+namespace Bits{
+    /**
+     * @brief Counts the set bits of the given mask.
+     * @param mask The mask to count the bits of.
+     * @return The number of set bits.
+     */
+	inline int popcount(uint32_t mask){
+#if defined(_MSC_VER)
+		return static_cast<int>(__popcnt(mask));
+#elif defined(__POPCNT__)
+		return __builtin_popcount(mask);
+#else
+		// without the popcnt instruction the builtin becomes a library call
+		mask = mask - ((mask >> 1) & 0x55555555u);
+		mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+		mask = (mask + (mask >> 4)) & 0x0F0F0F0Fu;
+		return static_cast<int>((mask * 0x01010101u) >> 24);
+#endif
+	}
+
+    /**
+     * @brief Counts the trailing zero bits of the given mask.
+     * @param mask The mask to inspect. Must not be 0.
+     * @return The index of the lowest set bit.
+     */
+	inline int ctz(uint32_t mask){
+#if defined(_MSC_VER)
+		unsigned long idx;
+		_BitScanForward(&idx, mask);
+		return static_cast<int>(idx);
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+}
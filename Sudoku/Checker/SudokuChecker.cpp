@@ -5,93 +5,429 @@
 * @date 26.12.2023.
 */
 
-#include <bitset>
-#include <vector>
+#include <algorithm>
+#include <cstdint>
 #include "SudokuChecker.hpp"
 #include "../Constants.hpp"
 #include "../Solver/SudokuSolver.hpp"
 
+// the kernel is picked at compile time, SUDOKU_CHECKER_NO_SIMD forces the plain loops
+#if !defined(SUDOKU_CHECKER_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define SUDOKU_CHECKER_AVX2
+#elif !defined(SUDOKU_CHECKER_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SUDOKU_CHECKER_SSE2
+#endif
+
 using Constants::BOARD_SIZE;
 using Constants::BLOCK_SIZE;
 
 namespace Sudoku{
-	bool SudokuChecker::isValid(const Board& board) {
-		// distinct values in every row
+	const SudokuChecker::KernelTables SudokuChecker::TABLES = SudokuChecker::buildKernelTables();
+
+	SudokuChecker::KernelTables SudokuChecker::buildKernelTables(){
+		KernelTables tables;
+		for(int ch=0; ch<256; ch++){
+			int k = Constants::keyIndex(static_cast<char>(ch));
+			tables.one_hot[ch] = k >= 0 ? static_cast<uint16_t>(1u << k) : INVALID_MASK;
+		}
+		tables.one_hot[static_cast<unsigned char>(Constants::EMPTY_CELL)] = 0;
 		for(int i=0; i<BOARD_SIZE; i++){
-			this->valueSet.reset();
 			for(int j=0; j<BOARD_SIZE; j++){
-				if(board[i][j] == Constants::EMPTY_CELL)
-					continue;
-				int idx = Constants::KEY_IDX.at(board[i][j]);
-				if(this->valueSet.test(idx))
-					return false;
-				this->valueSet[idx] = true;
+				int cell = i*BOARD_SIZE + j;
+				int b = Board::getBlockNum(i, j);
+				int t = (i%BLOCK_SIZE)*BLOCK_SIZE + j%BLOCK_SIZE; // position of the cell in its block
+				tables.offsets[cell][0] = static_cast<uint16_t>(j*UNIT_LANES + i);
+				tables.offsets[cell][1] = static_cast<uint16_t>(i*UNIT_LANES + BOARD_SIZE + j);
+				tables.offsets[cell][2] = static_cast<uint16_t>(t*UNIT_LANES + 2*BOARD_SIZE + b);
+				tables.unit_cells[i][j] = tables.unit_cells[BOARD_SIZE + j][i] = tables.unit_cells[2*BOARD_SIZE + b][t] = static_cast<uint8_t>(cell);
 			}
 		}
+		return tables;
+	}
 
-		// distinct values in every column
-		for(int j=0; j<BOARD_SIZE; j++){
-			this->valueSet.reset();
-			for(int i=0; i<BOARD_SIZE; i++){
-				if(board[i][j] == Constants::EMPTY_CELL)
-					continue;
-				int idx = Constants::KEY_IDX.at(board[i][j]);
-				if(this->valueSet.test(idx))
-					return false;
-				this->valueSet[idx] = true;
+	bool SudokuChecker::validateUnits(const UnitMasks& units){
+#if defined(SUDOKU_CHECKER_AVX2)
+		// two vectors of 16 lanes hold a member of every unit, the sums and unions stay in registers
+		const __m256i* members = reinterpret_cast<const __m256i*>(&units.masks[0][0]);
+		__m256i sum0 = _mm256_load_si256(members), sum1 = _mm256_load_si256(members + 1);
+		__m256i all0 = sum0, all1 = sum1;
+		for(int m=1; m<BOARD_SIZE; m++){
+			__m256i v0 = _mm256_load_si256(members + 2*m), v1 = _mm256_load_si256(members + 2*m + 1);
+			sum0 = _mm256_add_epi16(sum0, v0);
+			sum1 = _mm256_add_epi16(sum1, v1);
+			all0 = _mm256_or_si256(all0, v0);
+			all1 = _mm256_or_si256(all1, v1);
+		}
+		__m256i same = _mm256_and_si256(_mm256_cmpeq_epi16(sum0, all0), _mm256_cmpeq_epi16(sum1, all1));
+		return _mm256_movemask_epi8(same) == -1;
+#elif defined(SUDOKU_CHECKER_SSE2)
+		const __m128i* members = reinterpret_cast<const __m128i*>(&units.masks[0][0]);
+		__m128i sum0 = _mm_load_si128(members), sum1 = _mm_load_si128(members + 1);
+		__m128i sum2 = _mm_load_si128(members + 2), sum3 = _mm_load_si128(members + 3);
+		__m128i all0 = sum0, all1 = sum1, all2 = sum2, all3 = sum3;
+		for(int m=1; m<BOARD_SIZE; m++){
+			__m128i v0 = _mm_load_si128(members + 4*m), v1 = _mm_load_si128(members + 4*m + 1);
+			__m128i v2 = _mm_load_si128(members + 4*m + 2), v3 = _mm_load_si128(members + 4*m + 3);
+			sum0 = _mm_add_epi16(sum0, v0);
+			sum1 = _mm_add_epi16(sum1, v1);
+			sum2 = _mm_add_epi16(sum2, v2);
+			sum3 = _mm_add_epi16(sum3, v3);
+			all0 = _mm_or_si128(all0, v0);
+			all1 = _mm_or_si128(all1, v1);
+			all2 = _mm_or_si128(all2, v2);
+			all3 = _mm_or_si128(all3, v3);
+		}
+		__m128i same = _mm_and_si128(
+			_mm_and_si128(_mm_cmpeq_epi16(sum0, all0), _mm_cmpeq_epi16(sum1, all1)),
+			_mm_and_si128(_mm_cmpeq_epi16(sum2, all2), _mm_cmpeq_epi16(sum3, all3))
+		);
+		return _mm_movemask_epi8(same) == 0xFFFF;
+#else
+		uint16_t sum[UNIT_LANES], all[UNIT_LANES];
+		for(int u=0; u<UNIT_LANES; u++)
+			sum[u] = all[u] = units.masks[0][u];
+		for(int m=1; m<BOARD_SIZE; m++){
+			for(int u=0; u<UNIT_LANES; u++){
+				sum[u] = static_cast<uint16_t>(sum[u] + units.masks[m][u]);
+				all[u] |= units.masks[m][u];
 			}
 		}
+		uint16_t differ = 0;
+		for(int u=0; u<UNIT_LANES; u++)
+			differ |= sum[u] ^ all[u];
+		return differ == 0;
+#endif
+	}
+
+	bool SudokuChecker::validateBoard(const Board& board, UnitMasks& units){
+		uint16_t* masks = &units.masks[0][0];
+		uint16_t seen = 0;
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				uint16_t mask = TABLES.one_hot[static_cast<unsigned char>(board[i][j])];
+				const uint16_t* offsets = TABLES.offsets[i*BOARD_SIZE + j];
+				masks[offsets[0]] = masks[offsets[1]] = masks[offsets[2]] = mask;
+				seen |= mask;
+			}
+		}
+		return !(seen & INVALID_MASK) && validateUnits(units);
+	}
+
+	bool SudokuChecker::isValid(const Board& board) const {
+		UnitMasks units = {};
+		return validateBoard(board, units);
+	}
+
+	size_t SudokuChecker::isValid(const Board* boards, size_t count, bool* results) const {
+		// every board overwrites all the lanes of its units, so the padding is cleared only once
+		UnitMasks units = {};
+		size_t valid_cnt = 0;
+		for(size_t b=0; b<count; b++){
+			results[b] = validateBoard(boards[b], units);
+			valid_cnt += results[b];
+		}
+		return valid_cnt;
+	}
+
+	void SudokuChecker::loadBatchMasks(const BoardBatch& batch, size_t first, BatchMasks& masks){
+#if defined(SUDOKU_CHECKER_AVX2)
+		// low and high byte of the mask of every character minus '0', pshufb zeroes the negative EMPTY_CELL - '0'
+		const __m256i low_bytes = _mm256_setr_epi8(
+			0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0,
+			0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0
+		);
+		const __m256i high_bytes = _mm256_setr_epi8(
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0
+		);
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i last_value = _mm256_set1_epi8(BOARD_SIZE - 1);
+		const __m256i invalid = _mm256_set1_epi8((char)(INVALID_MASK >> 8));
+		for(int k=0; k<BoardBatch::CELL_COUNT; k++){
+			__m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.getCell(k) + first));
+			__m256i value = _mm256_sub_epi8(chars, _mm256_set1_epi8(Constants::ALPHABET[0]));
+			__m256i valid = _mm256_or_si256(
+				_mm256_cmpeq_epi8(_mm256_min_epu8(value, last_value), value),
+				_mm256_cmpeq_epi8(chars, zero)
+			);
+			__m256i index = _mm256_add_epi8(value, _mm256_set1_epi8(1));
+			__m256i low = _mm256_shuffle_epi8(low_bytes, index);
+			__m256i high = _mm256_or_si256(_mm256_shuffle_epi8(high_bytes, index), _mm256_andnot_si256(valid, invalid));
+			// the cell of boards 0-15 and 16-31 widened to 16 bit lanes
+			__m256i masks0 = _mm256_or_si256(
+				_mm256_cvtepu8_epi16(_mm256_castsi256_si128(low)),
+				_mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(high)), 8)
+			);
+			__m256i masks1 = _mm256_or_si256(
+				_mm256_cvtepu8_epi16(_mm256_extracti128_si256(low, 1)),
+				_mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(high, 1)), 8)
+			);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(&masks.masks[k][0]), masks0);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(&masks.masks[k][16]), masks1);
+		}
+#else
+		for(int k=0; k<BoardBatch::CELL_COUNT; k++){
+			const char* cell = batch.getCell(k) + first;
+			for(int b=0; b<BATCH_LANES; b++)
+				masks.masks[k][b] = TABLES.one_hot[static_cast<unsigned char>(cell[b])];
+		}
+#endif
+	}
 
-		// distinct values in every block
-		for(int k=0; k<BOARD_SIZE; k++){
-			this->valueSet.reset();
-			for(int i=0; i<BLOCK_SIZE; i++){
-				for(int j=0; j<BLOCK_SIZE; j++){
-					int ri = (k/BLOCK_SIZE)*BLOCK_SIZE + i;
-					int ci = (k%BLOCK_SIZE)*BLOCK_SIZE + j;
-					if(board[ri][ci] == Constants::EMPTY_CELL)
-						continue;
-					int idx = Constants::KEY_IDX.at(board[ri][ci]);
-					if(this->valueSet.test(idx))
-						return false;
-					this->valueSet[idx] = true;
+	uint32_t SudokuChecker::findInvalidBoards(const BatchMasks& masks){
+#if defined(SUDOKU_CHECKER_AVX2)
+		const __m256i* cells = reinterpret_cast<const __m256i*>(&masks.masks[0][0]);
+		__m256i same0 = _mm256_cmpeq_epi16(_mm256_setzero_si256(), _mm256_setzero_si256()), same1 = same0;
+		__m256i seen0 = _mm256_setzero_si256(), seen1 = seen0;
+		for(int u=0; u<3*BOARD_SIZE; u++){
+			const uint8_t* unit = TABLES.unit_cells[u];
+			__m256i sum0 = _mm256_load_si256(cells + 2*unit[0]), sum1 = _mm256_load_si256(cells + 2*unit[0] + 1);
+			__m256i all0 = sum0, all1 = sum1;
+			for(int m=1; m<BOARD_SIZE; m++){
+				__m256i v0 = _mm256_load_si256(cells + 2*unit[m]), v1 = _mm256_load_si256(cells + 2*unit[m] + 1);
+				sum0 = _mm256_add_epi16(sum0, v0);
+				sum1 = _mm256_add_epi16(sum1, v1);
+				all0 = _mm256_or_si256(all0, v0);
+				all1 = _mm256_or_si256(all1, v1);
+			}
+			same0 = _mm256_and_si256(same0, _mm256_cmpeq_epi16(sum0, all0));
+			same1 = _mm256_and_si256(same1, _mm256_cmpeq_epi16(sum1, all1));
+			seen0 = _mm256_or_si256(seen0, all0);
+			seen1 = _mm256_or_si256(seen1, all1);
+		}
+		// a board is valid if all its units are and it holds no INVALID_MASK
+		same0 = _mm256_andnot_si256(_mm256_srai_epi16(seen0, 15), same0);
+		same1 = _mm256_andnot_si256(_mm256_srai_epi16(seen1, 15), same1);
+		// packing interleaves the 128 bit halves, the permutation puts the boards back in order
+		__m256i valid = _mm256_permute4x64_epi64(_mm256_packs_epi16(same0, same1), 0xD8);
+		return ~static_cast<uint32_t>(_mm256_movemask_epi8(valid));
+#elif defined(SUDOKU_CHECKER_SSE2)
+		const __m128i* cells = reinterpret_cast<const __m128i*>(&masks.masks[0][0]);
+		uint32_t invalid = 0;
+		// 16 boards at a time, two vectors of 8
+		for(int h=0; h<BATCH_LANES/16; h++){
+			__m128i same0 = _mm_cmpeq_epi16(_mm_setzero_si128(), _mm_setzero_si128()), same1 = same0;
+			__m128i seen0 = _mm_setzero_si128(), seen1 = seen0;
+			for(int u=0; u<3*BOARD_SIZE; u++){
+				const uint8_t* unit = TABLES.unit_cells[u];
+				__m128i sum0 = _mm_load_si128(cells + 4*unit[0] + 2*h), sum1 = _mm_load_si128(cells + 4*unit[0] + 2*h + 1);
+				__m128i all0 = sum0, all1 = sum1;
+				for(int m=1; m<BOARD_SIZE; m++){
+					__m128i v0 = _mm_load_si128(cells + 4*unit[m] + 2*h), v1 = _mm_load_si128(cells + 4*unit[m] + 2*h + 1);
+					sum0 = _mm_add_epi16(sum0, v0);
+					sum1 = _mm_add_epi16(sum1, v1);
+					all0 = _mm_or_si128(all0, v0);
+					all1 = _mm_or_si128(all1, v1);
+				}
+				same0 = _mm_and_si128(same0, _mm_cmpeq_epi16(sum0, all0));
+				same1 = _mm_and_si128(same1, _mm_cmpeq_epi16(sum1, all1));
+				seen0 = _mm_or_si128(seen0, all0);
+				seen1 = _mm_or_si128(seen1, all1);
+			}
+			same0 = _mm_andnot_si128(_mm_srai_epi16(seen0, 15), same0);
+			same1 = _mm_andnot_si128(_mm_srai_epi16(seen1, 15), same1);
+			uint32_t valid = static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(same0, same1)));
+			invalid |= (~valid & 0xFFFFu) << (16*h);
+		}
+		return invalid;
+#else
+		uint16_t differ[BATCH_LANES] = {}, seen[BATCH_LANES] = {};
+		for(int u=0; u<3*BOARD_SIZE; u++){
+			const uint8_t* unit = TABLES.unit_cells[u];
+			uint16_t sum[BATCH_LANES], all[BATCH_LANES];
+			for(int b=0; b<BATCH_LANES; b++)
+				sum[b] = all[b] = masks.masks[unit[0]][b];
+			for(int m=1; m<BOARD_SIZE; m++){
+				for(int b=0; b<BATCH_LANES; b++){
+					sum[b] = static_cast<uint16_t>(sum[b] + masks.masks[unit[m]][b]);
+					all[b] |= masks.masks[unit[m]][b];
 				}
 			}
+			for(int b=0; b<BATCH_LANES; b++){
+				differ[b] |= sum[b] ^ all[b];
+				seen[b] |= all[b];
+			}
+		}
+		uint32_t invalid = 0;
+		for(int b=0; b<BATCH_LANES; b++){
+			if(differ[b] || (seen[b] & INVALID_MASK))
+				invalid |= 1u << b;
 		}
+		return invalid;
+#endif
+	}
+
+	size_t SudokuChecker::isValid(const BoardBatch& batch, bool* results) const {
+		static_assert(BoardBatch::LANE_COUNT == 32, "The batch kernel validates 32 boards at a time.");
+		BatchMasks masks;
+		size_t valid_cnt = 0;
+		// the cell arrays are padded with empty boards to a multiple of BATCH_LANES
+		for(size_t first=0; first<batch.size(); first+=BATCH_LANES){
+			loadBatchMasks(batch, first, masks);
+			uint32_t invalid = findInvalidBoards(masks);
+			size_t lane_cnt = std::min(batch.size() - first, static_cast<size_t>(BATCH_LANES));
+			for(size_t b=0; b<lane_cnt; b++){
+				results[first + b] = !((invalid >> b) & 1);
+				valid_cnt += results[first + b];
+			}
+		}
+		return valid_cnt;
+	}
 
+	const char* SudokuChecker::getKernelName(){
+#if defined(SUDOKU_CHECKER_AVX2)
+		return "avx2";
+#elif defined(SUDOKU_CHECKER_SSE2)
+		return "sse2";
+#else
+		return "scalar";
+#endif
+	}
+
+	bool SudokuChecker::isValid(const IndexBoard& board) const {
+		uint16_t rows[BOARD_SIZE] = {}, cols[BOARD_SIZE] = {}, blocks[BOARD_SIZE] = {};
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				int k = board[i][j];
+				if(k == IndexBoard::EMPTY)
+					continue;
+				uint16_t bit = static_cast<uint16_t>(1u << k);
+				int b = Board::getBlockNum(i, j);
+				if((rows[i] | cols[j] | blocks[b]) & bit)
+					return false;
+				rows[i] |= bit;
+				cols[j] |= bit;
+				blocks[b] |= bit;
+			}
+		}
 		return true;
 	}
 
 	bool SudokuChecker::isSolved(const Board& board, const Board& start_board,
 		int& correct_values, int& incorrect_values, int& empty_cells
 	) const {
-		std::vector<std::vector<int>> rows(BOARD_SIZE, std::vector<int>(BOARD_SIZE, 0)); // rows[i][j] = count of j-th character in i-th row
-		std::vector<std::vector<int>> cols(BOARD_SIZE, std::vector<int>(BOARD_SIZE, 0));
-		std::vector<std::vector<int>> blocks(BOARD_SIZE, std::vector<int>(BOARD_SIZE, 0));
+		SolutionReport report;
+		this->isSolved(board, start_board, report);
+		correct_values = report.correct_values;
+		incorrect_values = report.incorrect_values;
+		empty_cells = report.empty_cells;
+		return report.solved;
+	}
 
+	bool SudokuChecker::isSolved(const Board& board, const Board& start_board, SolutionReport& report) const {
+		// a value is repeated in a unit if its bit is in the unit's dups mask
+		uint16_t seen[3][BOARD_SIZE] = {}, dups[3][BOARD_SIZE] = {};
 		for(int i=0; i<BOARD_SIZE; i++){
 			for(int j=0; j<BOARD_SIZE; j++){
-				if(board[i][j] == Constants::EMPTY_CELL)
-					continue;
-				int idx = Constants::KEY_IDX.at(board[i][j]);
-				rows[i][idx]++;
-				cols[j][idx]++;
-				blocks[Sudoku::Board::getBlockNum(i, j)][idx]++;
+				int idx = Constants::keyIndex(board[i][j]);
+				if(idx < 0)
+					continue; // empty cells and characters outside of the alphabet
+				uint16_t bit = static_cast<uint16_t>(1u << idx);
+				const int units[3] = {i, j, Board::getBlockNum(i, j)};
+				for(int u=0; u<3; u++){
+					dups[u][units[u]] |= seen[u][units[u]] & bit;
+					seen[u][units[u]] |= bit;
+				}
 			}
 		}
 
 		bool is_tempered_with = false; // indicates wether the numbers from the initial board were changed.
-		correct_values = incorrect_values = empty_cells = 0;
+		report.correct_values = report.incorrect_values = report.empty_cells = 0;
 		for(int i=0; i<BOARD_SIZE; i++){
 			for(int j=0; j<BOARD_SIZE; j++){
+				CellStatus& status = report.status[i][j];
 				if(board[i][j] == Constants::EMPTY_CELL){
-					empty_cells++;
+					report.empty_cells++;
+					status = CELL_EMPTY;
 					if(start_board[i][j] != Constants::EMPTY_CELL){
 						is_tempered_with = true;
+						status = CELL_TAMPERED;
 					}
 					continue;
 				}
-				int idx = Constants::KEY_IDX.at(board[i][j]);
+				if(start_board[i][j] != Constants::EMPTY_CELL){
+					status = CELL_GIVEN;
+					if(board[i][j] != start_board[i][j]){
+						is_tempered_with = true;
+						report.incorrect_values++;
+						status = CELL_TAMPERED;
+					}
+					continue;
+				}
+				int idx = Constants::keyIndex(board[i][j]);
+				uint16_t bit = idx < 0 ? 0 : static_cast<uint16_t>(1u << idx);
+				if(idx < 0 || ((dups[0][i] | dups[1][j] | dups[2][Board::getBlockNum(i, j)]) & bit)){
+					report.incorrect_values++;
+					status = CELL_CONFLICTING;
+				} else {
+					report.correct_values++;
+					status = CELL_CORRECT;
+				}
+			}
+		}
+
+		report.solved = !is_tempered_with && report.incorrect_values == 0 && report.empty_cells == 0;
+		return report.solved;
+	}
+	template<int BlockSize>
+	bool SudokuChecker::isValid(const BasicBoard<BlockSize>& board) const {
+		typedef BoardTraits<BlockSize> Traits;
+		const int size = Traits::BOARD_SIZE;
+		typename Traits::Mask rows[size] = {}, cols[size] = {}, blocks[size] = {};
+		for(int i=0; i<size; i++){
+			for(int j=0; j<size; j++){
+				if(board[i][j] == Constants::EMPTY_CELL)
+					continue;
+				int k = Traits::index(board[i][j]);
+				if(k < 0)
+					return false;
+				typename Traits::Mask bit = static_cast<typename Traits::Mask>(1u << k);
+				int b = BasicBoard<BlockSize>::getBlockNum(i, j);
+				if((rows[i] | cols[j] | blocks[b]) & bit)
+					return false;
+				rows[i] |= bit;
+				cols[j] |= bit;
+				blocks[b] |= bit;
+			}
+		}
+		return true;
+	}
+
+	template<int BlockSize>
+	bool SudokuChecker::isSolved(const BasicBoard<BlockSize>& board, const BasicBoard<BlockSize>& start_board,
+		int& correct_values, int& incorrect_values, int& empty_cells
+	) const {
+		typedef BoardTraits<BlockSize> Traits;
+		typedef typename Traits::Mask Mask;
+		const int size = Traits::BOARD_SIZE;
+		// a value is repeated in a unit if its bit is in the unit's dups mask
+		Mask seen[3][size] = {}, dups[3][size] = {};
+		for(int i=0; i<size; i++){
+			for(int j=0; j<size; j++){
+				int idx = Traits::index(board[i][j]);
+				if(idx < 0)
+					continue; // empty cells and characters outside of the alphabet
+				Mask bit = static_cast<Mask>(1u << idx);
+				const int units[3] = {i, j, BasicBoard<BlockSize>::getBlockNum(i, j)};
+				for(int u=0; u<3; u++){
+					dups[u][units[u]] |= seen[u][units[u]] & bit;
+					seen[u][units[u]] |= bit;
+				}
+			}
+		}
+
+		bool is_tempered_with = false;
+		correct_values = incorrect_values = empty_cells = 0;
+		for(int i=0; i<size; i++){
+			for(int j=0; j<size; j++){
+				if(board[i][j] == Constants::EMPTY_CELL){
+					empty_cells++;
+					if(start_board[i][j] != Constants::EMPTY_CELL)
+						is_tempered_with = true;
+					continue;
+				}
 				if(start_board[i][j] != Constants::EMPTY_CELL){
 					if(board[i][j] != start_board[i][j]){
 						is_tempered_with = true;
@@ -99,17 +435,25 @@ namespace Sudoku{
 					}
 					continue;
 				}
-				if(rows[i][idx] > 1)
-					incorrect_values++;
-				else if(cols[j][idx] > 1)
-					incorrect_values++;
-				else if(blocks[Sudoku::Board::getBlockNum(i, j)][idx] > 1)
+				int idx = Traits::index(board[i][j]);
+				Mask bit = idx < 0 ? 0 : static_cast<Mask>(1u << idx);
+				if(idx < 0 || ((dups[0][i] | dups[1][j] | dups[2][BasicBoard<BlockSize>::getBlockNum(i, j)]) & bit))
 					incorrect_values++;
 				else
 					correct_values++;
 			}
 		}
-
-		return (!is_tempered_with && incorrect_values == 0 && empty_cells == 0);
+		return !is_tempered_with && incorrect_values == 0 && empty_cells == 0;
 	}
+
+	// every supported size is compiled here, 9x9 boards normally take the kernel overloads
+	template bool SudokuChecker::isValid(const BasicBoard<2>& board) const;
+	template bool SudokuChecker::isValid(const BasicBoard<3>& board) const;
+	template bool SudokuChecker::isValid(const BasicBoard<4>& board) const;
+	template bool SudokuChecker::isValid(const BasicBoard<5>& board) const;
+
+	template bool SudokuChecker::isSolved(const BasicBoard<2>& board, const BasicBoard<2>& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
+	template bool SudokuChecker::isSolved(const BasicBoard<3>& board, const BasicBoard<3>& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
+	template bool SudokuChecker::isSolved(const BasicBoard<4>& board, const BasicBoard<4>& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
+	template bool SudokuChecker::isSolved(const BasicBoard<5>& board, const BasicBoard<5>& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
 }
\ No newline at end of file
@@ -7,11 +7,37 @@
 
 #pragma once
 
-#include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include "../Sudoku/Board.hpp"
+#include "../Sudoku/IndexBoard.hpp"
+#include "../Sudoku/BoardBatch.hpp"
 #include "../Constants.hpp"
 
 namespace Sudoku{
+	/**
+	* @brief Status of a cell of a checked solution.
+	*/
+	enum CellStatus : uint8_t {
+		CELL_GIVEN, /**< A value of the start board, left unchanged. */
+		CELL_CORRECT, /**< A value that no other value of its row, column or block repeats. */
+		CELL_CONFLICTING, /**< A value repeated in its row, column or block, or a character outside of the alphabet. */
+		CELL_TAMPERED, /**< A value of the start board that was changed or cleared. */
+		CELL_EMPTY /**< An empty cell that was empty on the start board as well. */
+	};
+
+	/**
+	* @brief Outcome of checking a solution, with the status of every cell.
+	* @details Fixed size, so a report can live on the stack and be reused without allocating.
+	*/
+	struct SolutionReport {
+		CellStatus status[Constants::BOARD_SIZE][Constants::BOARD_SIZE]; /**< Status of every cell. */
+		int correct_values = 0; /**< Number of CELL_CORRECT cells. */
+		int incorrect_values = 0; /**< Number of CELL_CONFLICTING cells and changed values of the start board. */
+		int empty_cells = 0; /**< Number of empty cells, cleared values of the start board included. */
+		bool solved = false; /**< Whether the board is a correct solution of the start board. */
+	};
+
 	/**
 	* @brief Sudoku checker class with board validation utilities.
 	*/
@@ -19,9 +45,41 @@ namespace Sudoku{
 	public:
 		/**
 		* @brief Returns true if the board setup is valid. The setup is considered valid if the 3 rules of Sudoku are satisfied.
+		* 
+		* @details Characters outside of Constants::ALPHABET make the board invalid. The board is checked by a branch-free
+		kernel that uses AVX2 or SSE2 when the compiler targets them and plain loops otherwise, see getKernelName.
+		* 
+		* @param board The board to be validated.
+		*/
+		bool isValid(const Board& board) const;
+
+		/**
+		* @brief Validates many boards at once with the same kernel as isValid.
+		* @param boards Pointer to the first of the boards to be validated.
+		* @param count Number of boards.
+		* @param results Array of \p count flags, the i-th is set to the result of isValid for the i-th board.
+		* @return The number of valid boards.
+		*/
+		size_t isValid(const Board* boards, size_t count, bool* results) const;
+
+		/**
+		* @brief Validates every board of a batch, LANE_COUNT boards at a time.
+		* 
+		* @details Works on the cell arrays of the batch directly: every cell of 32 boards is turned into value masks with a
+		few vector instructions and every unit is summed across the boards, 16 boards per AVX2 and 8 per SSE2 instruction.
+		The results are the ones isValid gives for every board on its own.
+		* 
+		* @param batch The boards to be validated.
+		* @param results Array of batch.size() flags, the i-th is set to the result of isValid for the i-th board.
+		* @return The number of valid boards.
+		*/
+		size_t isValid(const BoardBatch& batch, bool* results) const;
+
+		/**
+		* @brief Returns true if the board setup is valid. Same as isValid for a Board, checked in a single pass with one value mask per unit.
 		* @param board The board to be validated.
 		*/
-		bool isValid(const Board& board);
+		bool isValid(const IndexBoard& board) const;
 
 		/**
 		* @brief Returns true if the board is a correct solution to the start_board. Sets \p correct_values, \p incorrect_values and \p empty_cells to their respective counts.
@@ -37,7 +95,122 @@ namespace Sudoku{
 		* @param empty_cells Reference to the variable where the number of cells that are left empty should be saved.
 		*/
 		bool isSolved(const Board& board, const Board& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
+
+		/**
+		* @brief Checks the solution like the isSolved overload with the counts, and reports the status of every cell as well.
+		* 
+		* @details Allocates nothing. The counts of the \p report are the ones the other overload returns. A cleared value of
+		the start board is counted as an empty cell and reported as CELL_TAMPERED.
+		* 
+		* @param board The board with the solution to be validated.
+		* @param start_board The starting configuration of the board.
+		* @param report The report to be filled in, every field is overwritten.
+		* @return true if the \p board is a correct solution to the \p start_board, the same as report.solved.
+		*/
+		bool isSolved(const Board& board, const Board& start_board, SolutionReport& report) const;
+
+		/**
+		* @brief Returns true if the setup of a board of any supported size is valid, see BoardTraits.
+		* 
+		* @details Checked with plain loops and one value mask per unit. 9x9 boards are checked by the kernel of the
+		non-template overload instead, which overload resolution picks for them.
+		* 
+		* @tparam BlockSize Number of rows and columns of a block.
+		* @param board The board to be validated.
+		*/
+		template<int BlockSize>
+		bool isValid(const BasicBoard<BlockSize>& board) const;
+
+		/**
+		* @brief Checks a solution of a board of any supported size like the isSolved overload with the counts for 9x9 boards.
+		* 
+		* @tparam BlockSize Number of rows and columns of a block.
+		* @param board The board with the solution to be validated.
+		* @param start_board The starting configuration of the board.
+		* @param correct_values Reference to the variable where the number of correctly placed values should be saved.
+		* @param incorrect_values Reference to the variable where the number of incorrectly placed values should be saved.
+		* @param empty_cells Reference to the variable where the number of cells that are left empty should be saved.
+		* @return true if the \p board is a correct solution to the \p start_board.
+		*/
+		template<int BlockSize>
+		bool isSolved(const BasicBoard<BlockSize>& board, const BasicBoard<BlockSize>& start_board, int& correct_values, int& incorrect_values, int& empty_cells) const;
+
+		/**
+		* @brief Returns the name of the validation kernel the checker was compiled with.
+		* @return "avx2", "sse2" or "scalar".
+		*/
+		static const char* getKernelName();
+
 	private:
-		std::bitset<Constants::BOARD_SIZE> valueSet;
+		static const int UNIT_LANES = 32; /**< Lanes of a member row of UnitMasks, one per unit plus padding. */
+
+		static_assert(3*Constants::BOARD_SIZE <= UNIT_LANES, "Every unit needs a lane.");
+		static_assert(Constants::BOARD_SIZE <= 12, "The sum of the masks of a unit must stay below the invalid bit.");
+
+		/**
+		* @brief Masks of the cells of a board laid out by unit: member m of unit u is at [m][u].
+		* @details Rows are units 0 to BOARD_SIZE-1, columns and blocks follow. A unit is valid if the sum of its masks
+		equals their union, which holds exactly when no value repeats, so all units are checked together lane by lane.
+		*/
+		struct UnitMasks {
+			alignas(32) uint16_t masks[Constants::BOARD_SIZE][UNIT_LANES]; /**< One-hot value mask of every unit member. */
+		};
+
+		/**
+		* @brief Lookup tables of the validation kernel.
+		*/
+		struct KernelTables {
+			uint16_t one_hot[256]; /**< Value mask of every character, 0 for EMPTY_CELL and INVALID_MASK outside of the alphabet. */
+			uint16_t offsets[Constants::BOARD_SIZE*Constants::BOARD_SIZE][3]; /**< Position in UnitMasks of every cell in its row, column and block. */
+			uint8_t unit_cells[3*Constants::BOARD_SIZE][Constants::BOARD_SIZE]; /**< Cells of every row, column and block. */
+		};
+
+		static const int BATCH_LANES = static_cast<int>(BoardBatch::LANE_COUNT); /**< Boards validated together by the batch kernel. */
+
+		/**
+		* @brief Value masks of BATCH_LANES boards of a batch, laid out like the batch: cell k of every board is at [k].
+		*/
+		struct BatchMasks {
+			alignas(32) uint16_t masks[BoardBatch::CELL_COUNT][BATCH_LANES]; /**< One-hot value mask of every cell, INVALID_MASK is set outside of the alphabet. */
+		};
+
+		static const uint16_t INVALID_MASK = 0x8000; /**< Mask of characters outside of the alphabet. */
+		static const KernelTables TABLES; /**< Tables of the validation kernel. */
+
+		/**
+		* @brief Builds the TABLES.
+		* @return The tables of the validation kernel.
+		*/
+		static KernelTables buildKernelTables();
+
+		/**
+		* @brief Checks that the masks of every unit are disjoint.
+		* @param units The unit masks of a board.
+		* @return true if no value repeats in any unit.
+		*/
+		static bool validateUnits(const UnitMasks& units);
+
+		/**
+		* @brief Lays the board out by unit and validates it.
+		* @param board The board to be validated.
+		* @param units Unit masks to write the board to. The padding lanes must be 0.
+		* @return true if the board is valid.
+		*/
+		static bool validateBoard(const Board& board, UnitMasks& units);
+
+		/**
+		* @brief Turns the cells of BATCH_LANES consecutive boards of a batch into value masks.
+		* @param batch The batch.
+		* @param first Index of the first board, a multiple of BATCH_LANES.
+		* @param masks The masks to write to.
+		*/
+		static void loadBatchMasks(const BoardBatch& batch, size_t first, BatchMasks& masks);
+
+		/**
+		* @brief Validates the boards of the masks.
+		* @param masks The masks of BATCH_LANES boards.
+		* @return Bitmap with the i-th bit set if the i-th board repeats a value in a unit or holds a character outside of the alphabet.
+		*/
+		static uint32_t findInvalidBoards(const BatchMasks& masks);
 	};
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
  */
 
 #include <stdexcept>
+#include <string>
 #include <filesystem>
 #include <fstream>
 #include "ArgumentParser.hpp"
@@ -13,19 +14,77 @@
 
 namespace CommandLine{
 	ArgumentParser::ArgumentParser(int argc, char *argv[])
-		: args(argv+1, argv+argc), is_valid(false), unique_solution(false), difficulty(Sudoku::Difficulty::MEDIUM) {}
+		: args(argv+1, argv+argc), is_valid(false), difficulty(Sudoku::Difficulty::MEDIUM), unique_solution(false), difficulty_set(false),
+		  batch(false), engine(Sudoku::SolverEngine::BACKTRACKING), engine_set(false), thread_count(0), thread_count_set(false), ordered(true),
+		  convert(false), format(FileIO::Format::GRID), format_set(false), generate_count(0), seed(0), seed_set(false),
+		  target_grade(Sudoku::Grade::SIMPLE), grade_set(false), serve(false), cache_capacity(0) {}
 
 	inline bool file_exists(const std::string& filename) {
 		std::ifstream f(filename.c_str());
 		return f.good();
 	}
 
+	inline bool parse_unsigned(const std::string& str, unsigned long long& value) {
+		if(str.empty() || str[0] < '0' || str[0] > '9')
+			return false;
+		size_t parsed = 0;
+		try{
+			value = std::stoull(str, &parsed);
+		}
+		catch(const std::exception&){
+			return false;
+		}
+		return parsed == str.size();
+	}
+
 	void ArgumentParser::parse(){
 		this->unique_solution = false;
+		this->difficulty_set = false;
+		this->batch = false;
+		this->engine_set = false;
+		this->thread_count_set = false;
+		this->ordered = true;
+		this->convert = false;
+		this->format_set = false;
+		this->generate_count = 0;
+		this->seed_set = false;
+		this->grade_set = false;
+		this->serve = false;
+		this->socket_path.clear();
+		this->cache_capacity = 0;
 		this->filenames.clear();
-		for(int i=0; i<this->args.size(); i++){
+		for(size_t i=0; i<this->args.size(); i++){
 			const std::string& arg = args[i];
-			if(arg[0] == '-'){
+			if(arg == "--batch"){
+				this->batch = true;
+			} else if(arg == "--convert"){
+				this->convert = true;
+			} else if(arg == "--generate" || arg == "--seed" || arg == "--cache"){
+				unsigned long long value;
+				if(++i == this->args.size() || !parse_unsigned(this->args[i], value) || (arg != "--seed" && value == 0)){
+					this->is_valid = false;
+					throw std::invalid_argument(std::string("Invalid or missing value for '") + arg + std::string("'."));
+				}
+				if(arg == "--generate"){
+					this->generate_count = value;
+				} else if(arg == "--cache"){
+					this->cache_capacity = value;
+				} else {
+					this->seed = value;
+					this->seed_set = true;
+				}
+			} else if(arg == "--serve"){
+				this->serve = true;
+			} else if(arg == "--socket"){
+				if(++i == this->args.size() || this->args[i].empty()){
+					this->is_valid = false;
+					throw std::invalid_argument("Missing path for '--socket'.");
+				}
+				this->socket_path = this->args[i];
+				this->serve = true;
+			} else if(arg == "--unordered"){
+				this->ordered = false;
+			} else if(arg[0] == '-'){
 				if(arg.length() != 2){
 					this->is_valid = false;
 					throw std::invalid_argument(std::string("Invalid command line argument '") + arg + std::string("'."));
@@ -37,7 +96,10 @@ namespace CommandLine{
 					break;
 				case 'd':
 				{
-					i++;
+					if(++i == this->args.size() || this->args[i].empty()){
+						this->is_valid = false;
+						throw std::invalid_argument("Missing option for difficulty.");
+					}
 					switch(this->args[i][0])
 					{
 					case 'e':
@@ -54,6 +116,103 @@ namespace CommandLine{
 						throw std::invalid_argument("Invalid option for difficulty. Available options are: 'e' - Easy 'm' - Medium, 'h' - Hard");
 						break;
 					}
+					this->difficulty_set = true;
+					break;
+				}
+				case 's':
+				{
+					if(++i == this->args.size() || this->args[i].empty()){
+						this->is_valid = false;
+						throw std::invalid_argument("Missing option for solver.");
+					}
+					switch(this->args[i][0])
+					{
+					case 'b':
+						this->engine = Sudoku::SolverEngine::BACKTRACKING;
+						break;
+					case 'm':
+						this->engine = Sudoku::SolverEngine::BITBOARD;
+						break;
+					case 'x':
+						this->engine = Sudoku::SolverEngine::DANCING_LINKS;
+						break;
+					default:
+						this->is_valid = false;
+						throw std::invalid_argument("Invalid option for solver. Available options are: 'b' - Backtracking, 'm' - Bitmask, 'x' - Dancing links");
+						break;
+					}
+					this->engine_set = true;
+					break;
+				}
+				case 'f':
+				{
+					if(++i == this->args.size() || this->args[i].empty()){
+						this->is_valid = false;
+						throw std::invalid_argument("Missing option for format.");
+					}
+					switch(this->args[i][0])
+					{
+					case 'g':
+						this->format = FileIO::Format::GRID;
+						break;
+					case 'l':
+						this->format = FileIO::Format::LINE;
+						break;
+					case 'b':
+						this->format = FileIO::Format::BINARY;
+						break;
+					default:
+						this->is_valid = false;
+						throw std::invalid_argument("Invalid option for format. Available options are: 'g' - Grid, 'l' - Line, 'b' - Binary");
+						break;
+					}
+					this->format_set = true;
+					break;
+				}
+				case 'g':
+				{
+					if(++i == this->args.size() || this->args[i].empty()){
+						this->is_valid = false;
+						throw std::invalid_argument("Missing option for grade.");
+					}
+					switch(this->args[i][0])
+					{
+					case 's':
+						this->target_grade = Sudoku::Grade::SIMPLE;
+						break;
+					case 'm':
+						this->target_grade = Sudoku::Grade::MODERATE;
+						break;
+					case 'a':
+						this->target_grade = Sudoku::Grade::ADVANCED;
+						break;
+					case 'e':
+						this->target_grade = Sudoku::Grade::EXPERT;
+						break;
+					case 'b':
+						this->target_grade = Sudoku::Grade::BEYOND_TECHNIQUES;
+						break;
+					default:
+						this->is_valid = false;
+						throw std::invalid_argument("Invalid option for grade. Available options are: 's' - Simple, 'm' - Moderate, 'a' - Advanced, 'e' - Expert, 'b' - Beyond techniques");
+						break;
+					}
+					this->grade_set = true;
+					break;
+				}
+				case 'j':
+				{
+					if(++i == this->args.size()){
+						this->is_valid = false;
+						throw std::invalid_argument("Missing thread count.");
+					}
+					unsigned long long value;
+					if(!parse_unsigned(this->args[i], value) || value > 4096){
+						this->is_valid = false;
+						throw std::invalid_argument(std::string("Invalid thread count: '") + this->args[i] + std::string("'."));
+					}
+					this->thread_count = static_cast<int>(value);
+					this->thread_count_set = true;
 					break;
 				}
 				default:
@@ -61,20 +220,51 @@ namespace CommandLine{
 					throw std::invalid_argument(std::string("Invalid option: '") + arg + std::string("'."));
 					break;
 				}
-			} else if(!file_exists(arg)){
-				this->is_valid = false;
-				throw std::invalid_argument(std::string("No such file: '") + arg + std::string("'."));
 			} else {
 				this->filenames.push_back(arg);
 			}
 		}
-		if(this->filenames.size() < 2){
+		bool generate = this->generate_count > 0;
+		if(int(this->batch) + int(this->convert) + int(generate) + int(this->serve) > 1){
 			this->is_valid = false;
-			throw std::invalid_argument("Please provide 2 filenames.");
-		} else if(this->filenames.size() > 2){
+			throw std::invalid_argument("Batch, convert, generate and serve modes cannot be combined.");
+		}
+		// an option that the selected mode does not use is rejected instead of being silently ignored
+		const char* mode = this->batch ? "batch" : this->convert ? "convert" : generate ? "generate" : this->serve ? "serve" : "game";
+		bool game = !this->batch && !this->convert && !generate && !this->serve;
+		auto checkMode = [&](bool passed, bool used, const char* option){
+			if(passed && !used){
+				this->is_valid = false;
+				throw std::invalid_argument(std::string("'") + option + std::string("' is not used by the ") + mode + std::string(" mode."));
+			}
+		};
+		checkMode(this->unique_solution, game || generate, "-u");
+		checkMode(this->difficulty_set, game || generate, "-d");
+		checkMode(this->engine_set, !this->convert, "-s");
+		checkMode(this->thread_count_set, !this->convert, "-j");
+		checkMode(this->format_set, this->convert || generate, "-f");
+		checkMode(this->grade_set, generate, "-g");
+		checkMode(this->seed_set, generate, "--seed");
+		checkMode(!this->ordered, this->batch, "--unordered");
+		checkMode(this->cache_capacity > 0, this->batch || this->serve, "--cache");
+		// generate mode only writes the pack of start boards, serve mode reads requests instead of files
+		size_t filename_cnt = this->serve ? 0 : generate ? 1 : 2;
+		if(this->filenames.size() < filename_cnt){
+			this->is_valid = false;
+			throw std::invalid_argument(generate ? "Please provide the output filename." : "Please provide 2 filenames.");
+		} else if(this->filenames.size() > filename_cnt){
 			this->is_valid = false;
 			throw std::invalid_argument("Too many filenames provided.");
 		}
+		for(size_t i=0; i<this->filenames.size(); i++){
+			// the batch, convert and generate output files are created by the run
+			if(generate || ((this->batch || this->convert) && i == 1))
+				continue;
+			if(!file_exists(this->filenames[i])){
+				this->is_valid = false;
+				throw std::invalid_argument(std::string("No such file: '") + this->filenames[i] + std::string("'."));
+			}
+		}
 		this->is_valid = true;
 	}
 
@@ -86,6 +276,9 @@ namespace CommandLine{
 		if(!this->is_valid){
 			throw std::invalid_argument("Unhandled invalid command line arguments list.");
 		}
+		if(this->filenames.empty()){
+			throw std::invalid_argument("No start filename in serve mode.");
+		}
 		return this->filenames[0];
 	}
 
@@ -93,6 +286,9 @@ namespace CommandLine{
 		if(!this->is_valid){
 			throw std::invalid_argument("Unhandled invalid command line arguments list.");
 		}
+		if(this->filenames.size() < 2){
+			throw std::invalid_argument("No solution filename in generate mode.");
+		}
 		return this->filenames[1];
 	}
 
@@ -109,4 +305,102 @@ namespace CommandLine{
 		}
 		return this->unique_solution;
 	}
-}
\ No newline at end of file
+
+	bool ArgumentParser::getBatch(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->batch;
+	}
+
+	Sudoku::SolverEngine ArgumentParser::getSolverEngine(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->engine;
+	}
+
+	int ArgumentParser::getThreadCount(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->thread_count;
+	}
+
+	bool ArgumentParser::getOrdered(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->ordered;
+	}
+
+	bool ArgumentParser::getConvert(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->convert;
+	}
+
+	FileIO::Format ArgumentParser::getFormat(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->format;
+	}
+
+	unsigned long long ArgumentParser::getGenerateCount(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->generate_count;
+	}
+
+	unsigned long long ArgumentParser::getSeed(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->seed;
+	}
+
+	bool ArgumentParser::getSeedSet(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->seed_set;
+	}
+
+	Sudoku::Grade ArgumentParser::getTargetGrade(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->target_grade;
+	}
+
+	bool ArgumentParser::getGradeSet(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->grade_set;
+	}
+
+	bool ArgumentParser::getServe(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->serve;
+	}
+
+	std::string ArgumentParser::getSocketPath(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->socket_path;
+	}
+
+	unsigned long long ArgumentParser::getCacheCapacity(){
+		if(!this->is_valid){
+			throw std::invalid_argument("Unhandled invalid command line arguments list.");
+		}
+		return this->cache_capacity;
+	}
+}
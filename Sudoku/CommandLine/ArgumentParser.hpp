@@ -10,6 +10,9 @@
 #include <vector>
 #include <string>
 #include "../Generator/SudokuGenerator.hpp"
+#include "../Solver/SudokuSolver.hpp"
+#include "../FileIO/FileIO.hpp"
+#include "../Grader/TechniqueGrader.hpp"
 
 /**
  * @brief Contains all classes and functions related to the command line arguments.
@@ -68,12 +71,137 @@ namespace CommandLine{
          */
 		bool getUnique();
 
+        /**
+         * @brief Checks if the batch flag is passed.
+         * @details In batch mode the start file holds one puzzle per line and the solutions are written to the solution file
+         * in the same format, without any prompts. The solution file does not have to exist.
+         * @return true if the batch flag is passed, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getBatch();
+
+        /**
+         * @brief Gets the solver engine.
+         * @return Sudoku::SolverEngine the solver engine
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		Sudoku::SolverEngine getSolverEngine();
+
+        /**
+         * @brief Gets the number of batch mode threads.
+         * @return int the number of threads, 0 if every hardware thread should be used
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		int getThreadCount();
+
+        /**
+         * @brief Checks if the batch mode output keeps the order of the input. It does unless the unordered flag is passed.
+         * @return true if the unordered flag is not passed, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getOrdered();
+
+        /**
+         * @brief Checks if the convert flag is passed.
+         * @details In convert mode the start file is converted to the solution file: a binary puzzle file to text,
+         * any other file to the binary puzzle format. The solution file does not have to exist.
+         * @return true if the convert flag is passed, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getConvert();
+
+        /**
+         * @brief Gets the output format of the convert and generate modes.
+         * @return FileIO::Format the output format
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		FileIO::Format getFormat();
+
+        /**
+         * @brief Gets the number of boards of the generate mode.
+         * @details In generate mode the pack of boards is written to the start file, which is the only filename.
+         * @return unsigned long long the number of boards, 0 if the generate option is not passed
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		unsigned long long getGenerateCount();
+
+        /**
+         * @brief Gets the seed of the generate mode.
+         * @return unsigned long long the seed
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		unsigned long long getSeed();
+
+        /**
+         * @brief Checks if the seed option is passed.
+         * @return true if the seed option is passed, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getSeedSet();
+
+        /**
+         * @brief Gets the target grade of the generate mode.
+         * @return Sudoku::Grade the target grade
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		Sudoku::Grade getTargetGrade();
+
+        /**
+         * @brief Checks if the grade option is passed.
+         * @return true if the grade option is passed, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getGradeSet();
+
+        /**
+         * @brief Checks if the serve flag or the socket option is passed.
+         * @details In serve mode requests are read line by line from the standard input, or from the clients of the
+         * socket, and answered until a shutdown request, see Server::RequestServer. No filenames are passed.
+         * @return true if the serve mode is selected, false otherwise
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		bool getServe();
+
+        /**
+         * @brief Gets the path of the Unix domain socket of the serve mode.
+         * @return std::string the socket path, empty if the standard input and output are served
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		std::string getSocketPath();
+
+        /**
+         * @brief Gets the capacity of the solution cache of the batch and serve modes.
+         * @details With a cache, puzzles that repeat an earlier puzzle up to relabeling, transposition and row or column swaps
+         * are not searched again, see Sudoku::SolutionCache.
+         * @return unsigned long long the maximum number of cached puzzles, 0 if the cache option is not passed
+         * @throw std::invalid_argument if the arguments are invalid or if they have not been parsed yet
+         */
+		unsigned long long getCacheCapacity();
+
 	private:
 		std::vector<std::string> args; /**<  Command line arguments */
 
 		bool is_valid; /**<  Flag that indicates if the arguments are valid */
-		std::vector<std::string> filenames; /**<  Filenames for start and solution boards. Should contain exactly 2 values after a valid parse. */
+		std::vector<std::string> filenames; /**<  Filenames for start and solution boards. Should contain exactly 2 values after a valid parse, 1 in generate mode. */
 		Sudoku::Difficulty difficulty; /**<  Difficulty for SudokuGenerator */
 		bool unique_solution; /**<  Flag that indicates if the unique flag is passed */
+		bool difficulty_set; /**<  Flag that indicates if the difficulty option is passed */
+		bool batch; /**<  Flag that indicates if the batch flag is passed */
+		Sudoku::SolverEngine engine; /**<  Search engine for SudokuSolver */
+		bool engine_set; /**<  Flag that indicates if the solver option is passed */
+		int thread_count; /**<  Number of batch mode threads, 0 for every hardware thread */
+		bool thread_count_set; /**<  Flag that indicates if the thread count option is passed */
+		bool ordered; /**<  Flag that indicates if the unordered flag is not passed */
+		bool convert; /**<  Flag that indicates if the convert flag is passed */
+		FileIO::Format format; /**<  Output format of the convert and generate modes */
+		bool format_set; /**<  Flag that indicates if the format option is passed */
+		unsigned long long generate_count; /**<  Number of boards of the generate mode, 0 if it is not selected */
+		unsigned long long seed; /**<  Seed of the generate mode */
+		bool seed_set; /**<  Flag that indicates if the seed option is passed */
+		Sudoku::Grade target_grade; /**<  Target grade of the generate mode */
+		bool grade_set; /**<  Flag that indicates if the grade option is passed */
+		bool serve; /**<  Flag that indicates if the serve flag or the socket option is passed */
+		std::string socket_path; /**<  Socket of the serve mode, empty for the standard input and output */
+		unsigned long long cache_capacity; /**<  Capacity of the solution cache, 0 if the cache option is not passed */
 	};
 }
\ No newline at end of file
@@ -7,28 +7,41 @@
 
 #pragma once
 
-#include <map>
+#include <array>
+#include <cstdint>
 
 namespace Constants{
 	const int BOARD_SIZE = 9;
 	const int BLOCK_SIZE = 3;
 
 	// characters that can be written to the board
-	const char ALPHABET[BOARD_SIZE] ={'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+	constexpr char ALPHABET[BOARD_SIZE] ={'1', '2', '3', '4', '5', '6', '7', '8', '9'};
 
 	// character that represents empty cell on the board
 	const char EMPTY_CELL = 0;
 
-	// index of each key in alphabet
-	const std::map<char, int> KEY_IDX({
-		{'1', 0},
-		{'2', 1},
-		{'3', 2},
-		{'4', 3},
-		{'5', 4},
-		{'6', 5},
-		{'7', 6},
-		{'8', 7},
-		{'9', 8},
-	});
+	/**
+	 * @brief Builds the KEY_IDX table.
+	 * @return The index in ALPHABET of every character, -1 for characters that are not in it.
+	 */
+	constexpr std::array<int8_t, 256> makeKeyIndex(){
+		std::array<int8_t, 256> key_idx = {};
+		for(int ch=0; ch<256; ch++)
+			key_idx[ch] = -1;
+		for(int k=0; k<BOARD_SIZE; k++)
+			key_idx[static_cast<unsigned char>(ALPHABET[k])] = static_cast<int8_t>(k);
+		return key_idx;
+	}
+
+	// index of each key in alphabet, built at compile time
+	constexpr std::array<int8_t, 256> KEY_IDX = makeKeyIndex();
+
+	/**
+	 * @brief Looks up the index of a character in ALPHABET.
+	 * @param ch The character.
+	 * @return The index of \p ch in ALPHABET, -1 if it is not in the alphabet (EMPTY_CELL included).
+	 */
+	constexpr int keyIndex(char ch){
+		return KEY_IDX[static_cast<unsigned char>(ch)];
+	}
 }
\ No newline at end of file
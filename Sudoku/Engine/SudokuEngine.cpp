@@ -0,0 +1,177 @@
+/**
+* @file SudokuEngine.cpp
+* @brief Implements the SudokuEngine.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include "SudokuEngine.hpp"
+
+namespace Sudoku{
+	SudokuEngine::SudokuEngine() : SudokuEngine(1) {}
+
+	SudokuEngine::SudokuEngine(int thread_count) : engine(BACKTRACKING), node_limit(0), pool(thread_count) {
+		for(int w=0; w<this->pool.getWorkerCount(); w++)
+			this->workers.emplace_back(new Worker());
+	}
+
+	int SudokuEngine::getThreadCount() const {
+		return this->pool.getWorkerCount();
+	}
+
+	void SudokuEngine::setSolverEngine(SolverEngine engine){
+		this->engine = engine;
+		for(std::unique_ptr<Worker>& worker : this->workers){
+			worker->solver.setEngine(engine);
+			worker->generator.setSolverEngine(engine);
+		}
+	}
+
+	SolverEngine SudokuEngine::getSolverEngine() const {
+		return this->engine;
+	}
+
+	void SudokuEngine::setCacheCapacity(size_t capacity){
+		this->cache.reset(capacity > 0 ? new SolutionCache(capacity) : nullptr);
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->solver.setSolutionCache(this->cache.get());
+	}
+
+	size_t SudokuEngine::getCacheCapacity() const {
+		return this->cache ? this->cache->getCapacity() : 0;
+	}
+
+	void SudokuEngine::setNodeLimit(uint64_t node_limit){
+		this->node_limit = node_limit;
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->solver.setSearchBudget(node_limit != 0 ? &worker->budget : nullptr);
+		this->counter.setSearchBudget(node_limit != 0 ? &this->count_budget : nullptr);
+	}
+
+	uint64_t SudokuEngine::getNodeLimit() const {
+		return this->node_limit;
+	}
+
+	void SudokuEngine::setDifficulty(Difficulty difficulty){
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->generator.setDifficulty(difficulty);
+	}
+
+	void SudokuEngine::setUnique(bool unique){
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->generator.setUnique(unique);
+	}
+
+	void SudokuEngine::setTargetGrade(Grade grade, int max_attempts){
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->generator.setTargetGrade(grade, max_attempts);
+	}
+
+	void SudokuEngine::clearTargetGrade(){
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->generator.clearTargetGrade();
+	}
+
+	bool SudokuEngine::isValid(const Board& board) const {
+		return this->checker.isValid(board);
+	}
+
+	size_t SudokuEngine::isValid(const Board* boards, size_t count, bool* results) const {
+		return this->checker.isValid(boards, count, results);
+	}
+
+	bool SudokuEngine::isSolved(const Board& board, const Board& start_board, SolutionReport& report) const {
+		return this->checker.isSolved(board, start_board, report);
+	}
+
+	SolveStatus SudokuEngine::solveWith(Worker& worker, const Board& puzzle, Board& solution, SolverStats* stats) const {
+		if(!this->checker.isValid(puzzle)){
+			solution = puzzle;
+			return SOLVE_INVALID;
+		}
+		if(this->node_limit != 0){
+			worker.budget = SearchBudget();
+			worker.budget.setNodeLimit(this->node_limit);
+		}
+		// the overload without stats does not read the clock
+		bool solved = stats ? worker.solver.solve(puzzle, worker.solution_board, *stats) : worker.solver.solve(puzzle, worker.solution_board);
+		if(!solved){
+			solution = puzzle;
+			return this->node_limit != 0 && worker.budget.exhausted() ? SOLVE_BUDGET : SOLVE_UNSOLVABLE;
+		}
+		solution = worker.solution_board;
+		return SOLVE_SOLVED;
+	}
+
+	SolveStatus SudokuEngine::solve(const Board& puzzle, Board& solution){
+		return this->solveWith(*this->workers[0], puzzle, solution, nullptr);
+	}
+
+	SolveStatus SudokuEngine::solve(const Board& puzzle, Board& solution, SolverStats& stats){
+		return this->solveWith(*this->workers[0], puzzle, solution, &stats);
+	}
+
+	size_t SudokuEngine::solve(const Board* puzzles, size_t count, Board* solutions, SolveStatus* statuses, SolverStats* stats){
+		std::vector<size_t> solved(this->workers.size(), 0);
+		for(std::unique_ptr<Worker>& worker : this->workers)
+			worker->stats = SolverStats();
+		int task_cnt = static_cast<int>((count + TASK_BOARDS - 1) / TASK_BOARDS);
+		this->pool.run(task_cnt, [&](int w, int t){
+			Worker& worker = *this->workers[w];
+			size_t end = std::min(count, (t + 1) * TASK_BOARDS);
+			for(size_t i=t*TASK_BOARDS; i<end; i++){
+				SolveStatus status = this->solveWith(worker, puzzles[i], solutions[i], stats ? &worker.stats : nullptr);
+				if(statuses)
+					statuses[i] = status;
+				if(status == SOLVE_SOLVED)
+					solved[w]++;
+			}
+		});
+
+		size_t solved_cnt = 0;
+		for(size_t w=0; w<this->workers.size(); w++){
+			solved_cnt += solved[w];
+			if(stats)
+				*stats += this->workers[w]->stats;
+		}
+		return solved_cnt;
+	}
+
+	int SudokuEngine::countSolutions(const Board& board, int limit){
+		if(!this->checker.isValid(board))
+			return 0;
+		if(this->node_limit != 0){
+			this->count_budget = SearchBudget();
+			this->count_budget.setNodeLimit(this->node_limit);
+		}
+		int count = this->counter.countSolutions(board, limit);
+		return this->node_limit != 0 && this->count_budget.exhausted() ? -1 : count;
+	}
+
+	void SudokuEngine::generateWith(Worker& worker, Board& board, uint64_t seed){
+		worker.generator.setSeed(seed);
+		board = Board(); // generation fills the board around its existing values
+		worker.generator.generateBoard(board);
+	}
+
+	void SudokuEngine::generate(Board& board, uint64_t seed){
+		this->generateWith(*this->workers[0], board, seed);
+	}
+
+	void SudokuEngine::generate(Board* boards, size_t count, uint64_t seed){
+		this->pool.run(static_cast<int>(count), [&](int w, int b){
+			this->generateWith(*this->workers[w], boards[b], SudokuGenerator::deriveSeed(seed, b));
+		});
+	}
+
+	void SudokuEngine::generate(Board* boards, const uint64_t* seeds, size_t count){
+		this->pool.run(static_cast<int>(count), [&](int w, int b){
+			this->generateWith(*this->workers[w], boards[b], seeds[b]);
+		});
+	}
+
+	GradeReport SudokuEngine::grade(const Board& board) const {
+		return this->grader.grade(board);
+	}
+}
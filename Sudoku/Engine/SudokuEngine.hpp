@@ -0,0 +1,273 @@
+/**
+* @file SudokuEngine.hpp
+* @brief Defines the SudokuEngine class, the in-memory interface of the library.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../Sudoku/Board.hpp"
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Checker/SudokuChecker.hpp"
+#include "../Solver/SudokuSolver.hpp"
+#include "../Solver/DancingLinks.hpp"
+#include "../Solver/SolverStats.hpp"
+#include "../Solver/SolutionCache.hpp"
+#include "../Generator/SudokuGenerator.hpp"
+#include "../Grader/TechniqueGrader.hpp"
+#include "../Batch/WorkStealingPool.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Outcome of SudokuEngine::solve for one puzzle.
+     */
+    enum SolveStatus : uint8_t {
+        SOLVE_SOLVED, /**< The solution was written. */
+        SOLVE_UNSOLVABLE, /**< The givens follow the rules but the puzzle has no solution. */
+        SOLVE_INVALID, /**< The givens break the rules or contain a character outside of the alphabet. */
+        SOLVE_BUDGET /**< The search ran out of the node limit of the engine before it decided the puzzle. */
+    };
+
+    /**
+     * @brief Solves, generates, checks and grades boards in memory.
+     *
+     * @details The library entry point for code that embeds the engine: every call works on Board values or arrays
+     * of them and never touches the filesystem. The array overloads of solve and generate spread the boards over a
+     * WorkStealingPool of the thread count given to the constructor, every thread with its own solver and generator.
+     *
+     * Generation is reproducible: a board generated with a seed only depends on the seed, the difficulty, the
+     * uniqueness and the target grade, and the n-th board of an array generated with a seed is the board that
+     * SudokuGenerator::deriveSeed(seed, n) generates alone, the same one BatchGenerator writes for that pack seed.
+     *
+     * An instance is not safe to use from several threads at the same time, a service keeps one engine per thread
+     * or one shared engine with several threads behind a lock.
+     */
+    class SudokuEngine {
+    public:
+        /**
+         * @brief Default constructor. Solves with the BACKTRACKING engine, generates MEDIUM boards without the
+         * uniqueness guarantee and runs everything on the calling thread.
+         */
+        SudokuEngine();
+
+        /**
+         * @brief Constructor.
+         * @param thread_count The number of threads of the array overloads. 0 uses every hardware thread.
+         */
+        explicit SudokuEngine(int thread_count);
+
+        SudokuEngine(const SudokuEngine&) = delete;
+        SudokuEngine& operator=(const SudokuEngine&) = delete;
+
+        /**
+         * @brief Getter for the number of threads.
+         * @return The number of threads the array overloads run on.
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Sets the search engine of solve and of the uniqueness checks of generate.
+         * @param engine The new search engine.
+         */
+        void setSolverEngine(SolverEngine engine);
+
+        /**
+         * @brief Getter for the search engine.
+         * @return The search engine used by solve.
+         */
+        SolverEngine getSolverEngine() const;
+
+        /**
+         * @brief Makes solve look every puzzle up in a SolutionCache shared by the threads, see SudokuSolver::setSolutionCache.
+         * @details Puzzles that only differ by a BoardTransform are solved once while they stay in the cache. Setting the
+         * capacity drops the cached puzzles.
+         * @param capacity The maximum number of cached puzzles, 0 to solve without a cache.
+         */
+        void setCacheCapacity(size_t capacity);
+
+        /**
+         * @brief Getter for the cache capacity.
+         * @return The maximum number of cached puzzles, 0 if solve runs without a cache.
+         */
+        size_t getCacheCapacity() const;
+
+        /**
+         * @brief Bounds the search of every solve and countSolutions call by a number of nodes, see SearchBudget.
+         * @details A solve that runs out of nodes returns SOLVE_BUDGET and a count returns -1, so one pathological puzzle
+         * cannot hold a service. Puzzles answered by the solution cache search no nodes.
+         * @param node_limit The maximum number of nodes of one puzzle, 0 for unbounded searches.
+         */
+        void setNodeLimit(uint64_t node_limit);
+
+        /**
+         * @brief Getter for the node limit.
+         * @return The maximum number of nodes of one puzzle, 0 if the searches are unbounded.
+         */
+        uint64_t getNodeLimit() const;
+
+        /**
+         * @brief Sets the difficulty of the generated boards.
+         * @param difficulty The new difficulty level.
+         */
+        void setDifficulty(Difficulty difficulty);
+
+        /**
+         * @brief Sets whether the generated boards must have a unique solution.
+         * @param unique The new uniqueness.
+         */
+        void setUnique(bool unique);
+
+        /**
+         * @brief Makes generate aim for boards of the given grade, see SudokuGenerator::setTargetGrade.
+         * @param grade The target grade.
+         * @param max_attempts The maximum number of boards generated per returned board.
+         * @throw std::invalid_argument if \p max_attempts is less than 1
+         */
+        void setTargetGrade(Grade grade, int max_attempts = 64);
+
+        /**
+         * @brief Makes generate use the difficulty again instead of a target grade.
+         */
+        void clearTargetGrade();
+
+        /**
+         * @brief Checks that the givens of the board break none of the rules.
+         * @param board The board to check.
+         * @return True if no row, column or block repeats a value and every cell is empty or in the alphabet.
+         */
+        bool isValid(const Board& board) const;
+
+        /**
+         * @brief Checks the givens of \p count boards, see SudokuChecker::isValid.
+         * @param boards The boards to check.
+         * @param count The number of boards.
+         * @param results Set to the result of every board, must hold \p count values.
+         * @return The number of valid boards.
+         */
+        size_t isValid(const Board* boards, size_t count, bool* results) const;
+
+        /**
+         * @brief Checks a solution against its start board, see SudokuChecker::isSolved.
+         * @param board The solution to check.
+         * @param start_board The puzzle the solution was started from.
+         * @param report Set to the status of every cell and the counts of the check.
+         * @return True if the board is completely and correctly solved.
+         */
+        bool isSolved(const Board& board, const Board& start_board, SolutionReport& report) const;
+
+        /**
+         * @brief Solves a puzzle.
+         * @param puzzle The puzzle.
+         * @param solution Set to the solution, or to the puzzle if there is none.
+         * @return SOLVE_SOLVED, SOLVE_UNSOLVABLE, SOLVE_INVALID or SOLVE_BUDGET.
+         */
+        SolveStatus solve(const Board& puzzle, Board& solution);
+
+        /**
+         * @brief Solves a puzzle and adds the work of the search to \p stats.
+         * @param puzzle The puzzle.
+         * @param solution Set to the solution, or to the puzzle if there is none.
+         * @param stats The stats the search is added to. Invalid puzzles are not searched and add nothing.
+         * @return SOLVE_SOLVED, SOLVE_UNSOLVABLE, SOLVE_INVALID or SOLVE_BUDGET.
+         */
+        SolveStatus solve(const Board& puzzle, Board& solution, SolverStats& stats);
+
+        /**
+         * @brief Solves \p count puzzles on the threads of the engine.
+         * @param puzzles The puzzles.
+         * @param count The number of puzzles.
+         * @param solutions Set to the solution of every puzzle, or to the puzzle if there is none. Must hold \p count boards
+         * and may be \p puzzles itself.
+         * @param statuses Set to the outcome of every puzzle if not nullptr, must then hold \p count values.
+         * @param stats The stats the searches of every thread are added to, or nullptr.
+         * @return The number of solved puzzles.
+         */
+        size_t solve(const Board* puzzles, size_t count, Board* solutions, SolveStatus* statuses = nullptr, SolverStats* stats = nullptr);
+
+        /**
+         * @brief Counts the solutions of a board, stopping as soon as \p limit solutions are found.
+         * @param board The board.
+         * @param limit The maximum number of solutions to look for.
+         * @return The number of solutions if it is less than \p limit, \p limit otherwise. 0 for an invalid board, -1 if
+         * the search ran out of the node limit.
+         */
+        int countSolutions(const Board& board, int limit = 2);
+
+        /**
+         * @brief Generates a board from a seed.
+         * @param board Set to the generated board.
+         * @param seed The seed, the same seed always generates the same board.
+         */
+        void generate(Board& board, uint64_t seed);
+
+        /**
+         * @brief Generates \p count boards on the threads of the engine.
+         * @param boards Set to the generated boards, must hold \p count boards.
+         * @param count The number of boards.
+         * @param seed The seed of the array, board n is generated from SudokuGenerator::deriveSeed(seed, n).
+         */
+        void generate(Board* boards, size_t count, uint64_t seed);
+
+        /**
+         * @brief Generates \p count boards from their own seeds on the threads of the engine.
+         * @param boards Set to the generated boards, must hold \p count boards.
+         * @param seeds The seed of every board, board n is the board generate(board, seeds[n]) generates.
+         * @param count The number of boards.
+         */
+        void generate(Board* boards, const uint64_t* seeds, size_t count);
+
+        /**
+         * @brief Grades a board by the techniques a person needs to solve it, see TechniqueGrader.
+         * @param board The board to grade.
+         * @return The grade and the counts of every technique.
+         */
+        GradeReport grade(const Board& board) const;
+
+    private:
+        static const size_t TASK_BOARDS = 16; /**< Boards per task of the array overloads. */
+
+        /**
+         * @brief Solver, generator and scratch boards of one thread.
+         */
+        struct Worker {
+            SudokuSolver solver; /**< Solver of the puzzles of the worker. */
+            SudokuGenerator generator; /**< Generator of the boards of the worker. */
+            MarkedBoard solution_board; /**< The solution of the puzzle that is being solved. */
+            SearchBudget budget; /**< Node budget of the puzzle that is being solved, reset for every puzzle. */
+            SolverStats stats; /**< Work of the searches of the current array call. */
+        };
+
+        SolverEngine engine; /**< Search engine of every solver and generator. */
+        SudokuChecker checker; /**< Checks the givens of every puzzle before it is solved. */
+        TechniqueGrader grader; /**< Grades boards. */
+        DancingLinks counter; /**< Counts solutions. */
+        uint64_t node_limit; /**< Maximum number of nodes of one puzzle, 0 for none. */
+        SearchBudget count_budget; /**< Node budget of the running countSolutions call. */
+        std::unique_ptr<SolutionCache> cache; /**< Cache of the solvers of every worker, or nullptr. */
+        std::vector<std::unique_ptr<Worker>> workers; /**< One worker per thread, the first one also serves the single board calls. */
+        WorkStealingPool pool; /**< Runs the tasks of the array overloads. */
+
+        /**
+         * @brief Solves one puzzle with the solver of a worker.
+         * @param worker The worker.
+         * @param puzzle The puzzle.
+         * @param solution Set to the solution, or to the puzzle if there is none.
+         * @param stats The stats the search is added to, or nullptr.
+         * @return SOLVE_SOLVED, SOLVE_UNSOLVABLE, SOLVE_INVALID or SOLVE_BUDGET.
+         */
+        SolveStatus solveWith(Worker& worker, const Board& puzzle, Board& solution, SolverStats* stats) const;
+
+        /**
+         * @brief Generates a board from a seed with the generator of a worker.
+         * @param worker The worker.
+         * @param board Set to the generated board.
+         * @param seed The seed of the board.
+         */
+        static void generateWith(Worker& worker, Board& board, uint64_t seed);
+    };
+}
@@ -0,0 +1,201 @@
+/**
+ * @file BinaryFormat.cpp
+ * @brief Implements the packed binary puzzle format.
+ * @author Nikola Jolovic
+ * @date 18.10.2026
+ */
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include "BinaryFormat.hpp"
+#include "FileIO.hpp"
+#include "../Constants.hpp"
+
+using Constants::BOARD_SIZE;
+
+namespace FileIO{
+	namespace Binary{
+		static const uint8_t INVALID_NIBBLE = 0xFF;
+
+		// nibble of every character that can be written to the board, INVALID_NIBBLE for anything else
+		static std::array<uint8_t, 256> buildNibbleTable(){
+			std::array<uint8_t, 256> table;
+			table.fill(INVALID_NIBBLE);
+			table[static_cast<unsigned char>(Constants::EMPTY_CELL)] = 0;
+			for(int k=0; k<BOARD_SIZE; k++)
+				table[static_cast<unsigned char>(Constants::ALPHABET[k])] = static_cast<uint8_t>(k + 1);
+			return table;
+		}
+
+		static const std::array<uint8_t, 256> NIBBLE = buildNibbleTable();
+
+		void pack(const Sudoku::Board& board, uint8_t* record){
+			std::memset(record, 0, RECORD_SIZE);
+			for(int i=0; i<BOARD_SIZE; i++){
+				const char* row = board[i];
+				for(int j=0; j<BOARD_SIZE; j++){
+					int cell = i*BOARD_SIZE + j;
+					uint8_t nibble = NIBBLE[static_cast<unsigned char>(row[j])];
+					if(nibble == INVALID_NIBBLE)
+						throw std::invalid_argument("Cannot pack a cell outside of the alphabet.");
+					record[cell >> 1] |= nibble << ((cell & 1) * 4);
+				}
+			}
+		}
+
+		void unpack(const uint8_t* record, Sudoku::Board& board){
+			for(int i=0; i<BOARD_SIZE; i++){
+				char* row = board[i];
+				for(int j=0; j<BOARD_SIZE; j++){
+					int cell = i*BOARD_SIZE + j;
+					int nibble = (record[cell >> 1] >> ((cell & 1) * 4)) & 0xF;
+					if(nibble > BOARD_SIZE)
+						throw std::invalid_argument("Corrupt board record in binary puzzle file.");
+					row[j] = nibble == 0 ? Constants::EMPTY_CELL : Constants::ALPHABET[nibble - 1];
+				}
+			}
+		}
+	}
+
+	BinaryPuzzleWriter::BinaryPuzzleWriter(const std::string& filename)
+		: out(filename, std::ios::binary | std::ios::trunc), count(0)
+	{
+		if(!this->out)
+			throw std::invalid_argument(std::string("Cannot create file: '") + filename + std::string("'."));
+		char header[Binary::HEADER_SIZE] = {};
+		std::memcpy(header, Binary::MAGIC, sizeof(Binary::MAGIC));
+		header[4] = static_cast<char>(Binary::VERSION);
+		header[5] = static_cast<char>(BOARD_SIZE);
+		header[6] = static_cast<char>(Binary::CELL_BITS);
+		if(!this->out.write(header, sizeof(header)))
+			throw std::runtime_error(std::string("Cannot write to file: '") + filename + std::string("'."));
+	}
+
+	BinaryPuzzleWriter::~BinaryPuzzleWriter(){
+		// a destructor must not throw, call close to see the errors
+		try{
+			this->close();
+		} catch(const std::runtime_error&){
+		}
+	}
+
+	void BinaryPuzzleWriter::write(const Sudoku::Board& board){
+		uint8_t record[Binary::RECORD_SIZE];
+		Binary::pack(board, record);
+		if(!this->out.write(reinterpret_cast<const char*>(record), sizeof(record)))
+			throw std::runtime_error("Cannot write to binary puzzle file.");
+		this->count++;
+	}
+
+	uint64_t BinaryPuzzleWriter::size() const {
+		return this->count;
+	}
+
+	void BinaryPuzzleWriter::close(){
+		if(!this->out.is_open())
+			return;
+		char count_bytes[8];
+		for(int b=0; b<8; b++)
+			count_bytes[b] = static_cast<char>((this->count >> (8*b)) & 0xFF);
+		this->out.seekp(Binary::COUNT_OFFSET);
+		this->out.write(count_bytes, sizeof(count_bytes));
+		this->out.close();
+		if(!this->out)
+			throw std::runtime_error("Cannot write to binary puzzle file.");
+	}
+
+	BinaryPuzzleReader::BinaryPuzzleReader(const std::string& filename)
+		: in(filename, std::ios::binary), count(0), position(0)
+	{
+		if(!this->in)
+			throw std::invalid_argument(std::string("Cannot open file: '") + filename + std::string("'."));
+		unsigned char header[Binary::HEADER_SIZE];
+		if(!this->in.read(reinterpret_cast<char*>(header), sizeof(header))
+			|| std::memcmp(header, Binary::MAGIC, sizeof(Binary::MAGIC)) != 0)
+			throw std::invalid_argument(std::string("Not a binary puzzle file: '") + filename + std::string("'."));
+		if(header[4] != Binary::VERSION || header[5] != BOARD_SIZE || header[6] != Binary::CELL_BITS)
+			throw std::invalid_argument(std::string("Unsupported binary puzzle file: '") + filename + std::string("'."));
+		for(int b=0; b<8; b++)
+			this->count |= static_cast<uint64_t>(header[Binary::COUNT_OFFSET + b]) << (8*b);
+	}
+
+	uint64_t BinaryPuzzleReader::size() const {
+		return this->count;
+	}
+
+	bool BinaryPuzzleReader::next(Sudoku::Board& board){
+		if(this->position == this->count)
+			return false;
+		uint8_t record[Binary::RECORD_SIZE];
+		if(!this->in.read(reinterpret_cast<char*>(record), sizeof(record)))
+			throw std::invalid_argument("Binary puzzle file is shorter than its header states.");
+		Binary::unpack(record, board);
+		this->position++;
+		return true;
+	}
+
+	void BinaryPuzzleReader::seek(uint64_t index){
+		if(index > this->count)
+			throw std::out_of_range("Board index out of range.");
+		this->in.clear();
+		this->in.seekg(static_cast<std::streamoff>(Binary::HEADER_SIZE + index*Binary::RECORD_SIZE));
+		this->position = index;
+	}
+
+	void BinaryPuzzleReader::read(uint64_t index, Sudoku::Board& board){
+		if(index >= this->count)
+			throw std::out_of_range("Board index out of range.");
+		this->seek(index);
+		this->next(board);
+	}
+
+	uint64_t textToBinary(const std::string& text_filename, const std::string& binary_filename){
+		std::ifstream in(text_filename);
+		if(!in)
+			throw std::invalid_argument(std::string("Cannot open file: '") + text_filename + std::string("'."));
+		BinaryPuzzleWriter writer(binary_filename);
+		Sudoku::Board board;
+		while(true){
+			// skip the line terminators between boards
+			int ch = in.peek();
+			while(ch == '\n' || ch == '\r'){
+				in.get();
+				ch = in.peek();
+			}
+			if(ch == std::char_traits<char>::eof())
+				break;
+			if(detectFormat(in) == GRID){
+				in >> board;
+			} else if(!readLine(in, board)){
+				break;
+			}
+			writer.write(board);
+		}
+		writer.close();
+		return writer.size();
+	}
+
+	uint64_t binaryToText(const std::string& binary_filename, const std::string& text_filename, Format format){
+		if(format == BINARY)
+			throw std::invalid_argument("BINARY is not a text format.");
+		BinaryPuzzleReader reader(binary_filename);
+		std::ofstream out(text_filename);
+		if(!out)
+			throw std::invalid_argument(std::string("Cannot create file: '") + text_filename + std::string("'."));
+		Sudoku::Board board;
+		while(reader.next(board)){
+			if(format == LINE)
+				writeLine(out, board);
+			else
+				out << board;
+		}
+		return reader.size();
+	}
+
+	bool isBinaryFile(const std::string& filename){
+		std::ifstream in(filename, std::ios::binary);
+		char magic[sizeof(Binary::MAGIC)];
+		return in.read(magic, sizeof(magic)) && std::memcmp(magic, Binary::MAGIC, sizeof(magic)) == 0;
+	}
+}
@@ -0,0 +1,177 @@
+/**
+ * @file BinaryFormat.hpp
+ * @brief Defines the packed binary puzzle format with its reader, writer and text converters.
+ * @author Nikola Jolovic
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "../Sudoku/Board.hpp"
+#include "../Constants.hpp"
+#include "FileIO.hpp"
+
+namespace FileIO{
+    /**
+     * @brief Layout of the packed binary puzzle format.
+     * 
+     * @details A file starts with a HEADER_SIZE byte header: the magic "SDKB", the format version, BOARD_SIZE,
+     * the number of bits per cell and a reserved zero byte, followed by the number of boards as a little-endian 64 bit integer.
+     * The header is followed by the boards, RECORD_SIZE bytes each. Every cell takes 4 bits in row-major order,
+     * the low nibble of a byte holding the cell with the even index: 0 for an empty cell and k+1 for Constants::ALPHABET[k].
+     * A 9x9 board takes 41 bytes, so the n-th board is always at HEADER_SIZE + n*RECORD_SIZE.
+     */
+	namespace Binary{
+		static_assert(Constants::BOARD_SIZE < 16, "The binary format stores a cell in 4 bits.");
+
+		const char MAGIC[4] = {'S', 'D', 'K', 'B'}; /**< First bytes of every binary puzzle file. */
+		const uint8_t VERSION = 1; /**< Version of the format written by BinaryPuzzleWriter. */
+		const uint8_t CELL_BITS = 4; /**< Bits per cell. */
+		const int HEADER_SIZE = 16; /**< Size of the header in bytes. */
+		const int COUNT_OFFSET = 8; /**< Offset of the board count in the header. */
+		const int RECORD_SIZE = (Constants::BOARD_SIZE*Constants::BOARD_SIZE*CELL_BITS + 7) / 8; /**< Size of one board in bytes. */
+
+        /**
+         * @brief Packs a board into a record.
+         * @param board The board to pack. Its cells must be empty or hold values of the alphabet.
+         * @param record The RECORD_SIZE bytes the board is written to.
+         * @throw std::invalid_argument if a cell holds a character outside of the alphabet
+         */
+		void pack(const Sudoku::Board& board, uint8_t* record);
+
+        /**
+         * @brief Unpacks a record into a board.
+         * @param record The RECORD_SIZE bytes of the board.
+         * @param board Board to load the data into.
+         * @throw std::invalid_argument if a cell holds a value outside of the alphabet
+         */
+		void unpack(const uint8_t* record, Sudoku::Board& board);
+	}
+
+    /**
+     * @brief Appends boards to a binary puzzle file.
+     * 
+     * @details The board count in the header is written when the writer is closed or destroyed.
+     */
+	class BinaryPuzzleWriter{
+	public:
+        /**
+         * @brief Constructor. Creates the file, replacing an existing one, and writes the header.
+         * @param filename Path to the file.
+         * @throw std::invalid_argument if the file cannot be created
+         * @throw std::runtime_error if the header cannot be written
+         */
+		BinaryPuzzleWriter(const std::string& filename);
+
+        /**
+         * @brief Destructor. Closes the file if it is still open, ignoring write errors.
+         */
+		~BinaryPuzzleWriter();
+
+		BinaryPuzzleWriter(const BinaryPuzzleWriter&) = delete;
+		BinaryPuzzleWriter& operator=(const BinaryPuzzleWriter&) = delete;
+
+        /**
+         * @brief Appends a board to the file.
+         * @param board The board to append.
+         * @throw std::invalid_argument if a cell holds a character outside of the alphabet
+         * @throw std::runtime_error if the board cannot be written
+         */
+		void write(const Sudoku::Board& board);
+
+        /**
+         * @brief Getter for the number of boards written.
+         * @return The number of boards written.
+         */
+		uint64_t size() const;
+
+        /**
+         * @brief Writes the board count to the header and closes the file.
+         * @throw std::runtime_error if a board or the count could not be written
+         */
+		void close();
+
+	private:
+		std::ofstream out; /**< The file. */
+		uint64_t count; /**< Number of boards written. */
+	};
+
+    /**
+     * @brief Reads boards from a binary puzzle file, sequentially or by index.
+     */
+	class BinaryPuzzleReader{
+	public:
+        /**
+         * @brief Constructor. Opens the file and reads its header.
+         * @param filename Path to the file.
+         * @throw std::invalid_argument if the file cannot be opened or is not a binary puzzle file for this BOARD_SIZE
+         */
+		BinaryPuzzleReader(const std::string& filename);
+
+        /**
+         * @brief Getter for the number of boards in the file.
+         * @return The number of boards in the file.
+         */
+		uint64_t size() const;
+
+        /**
+         * @brief Reads the board at the current position and moves to the next one.
+         * @param board Board to load the data into.
+         * @return false if every board has been read, true otherwise.
+         * @throw std::invalid_argument if the record is corrupt
+         */
+		bool next(Sudoku::Board& board);
+
+        /**
+         * @brief Moves to the board with the given index, so that it is returned by the next call to next.
+         * @param index The index of the board.
+         * @throw std::out_of_range if \p index is greater than the number of boards
+         */
+		void seek(uint64_t index);
+
+        /**
+         * @brief Reads the board with the given index.
+         * @param index The index of the board.
+         * @param board Board to load the data into.
+         * @throw std::out_of_range if there is no board with the given index
+         * @throw std::invalid_argument if the record is corrupt
+         */
+		void read(uint64_t index, Sudoku::Board& board);
+
+	private:
+		std::ifstream in; /**< The file. */
+		uint64_t count; /**< Number of boards in the file. */
+		uint64_t position; /**< Index of the board returned by the next call to next. */
+	};
+
+    /**
+     * @brief Converts a text file with any number of boards to a binary puzzle file.
+     * @details The format of every board is detected separately, so grid and line boards may be mixed.
+     * @param text_filename Path to the text file.
+     * @param binary_filename Path to the binary file. It is replaced if it exists.
+     * @return The number of converted boards.
+     * @throw std::invalid_argument if a file cannot be opened, a line board is malformed or a board holds a character outside of the alphabet
+     * @throw std::runtime_error if the binary file cannot be written
+     */
+	uint64_t textToBinary(const std::string& text_filename, const std::string& binary_filename);
+
+    /**
+     * @brief Converts a binary puzzle file to a text file.
+     * @param binary_filename Path to the binary file.
+     * @param text_filename Path to the text file. It is replaced if it exists.
+     * @param format Format of the boards in the text file, GRID or LINE.
+     * @return The number of converted boards.
+     * @throw std::invalid_argument if a file cannot be opened, the binary file is corrupt or \p format is BINARY
+     */
+	uint64_t binaryToText(const std::string& binary_filename, const std::string& text_filename, Format format = GRID);
+
+    /**
+     * @brief Checks if a file starts with the magic of the binary puzzle format.
+     * @param filename Path to the file.
+     * @return true if the file can be opened and starts with Binary::MAGIC, false otherwise.
+     */
+	bool isBinaryFile(const std::string& filename);
+}
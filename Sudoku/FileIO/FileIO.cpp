@@ -7,17 +7,105 @@
 
 #include <string>
 #include <fstream>
+#include <stdexcept>
+#include <array>
 #include "../Sudoku/Board.hpp"
 #include "FileIO.hpp"
+#include "BinaryFormat.hpp"
+#include "../Constants.hpp"
+
+using Constants::BOARD_SIZE;
 
 namespace FileIO{
 	void loadFromFile(std::string filename, Sudoku::Board& board){
+		if(isBinaryFile(filename)){
+			BinaryPuzzleReader reader(filename);
+			if(!reader.next(board))
+				throw std::invalid_argument(std::string("No board in file: '") + filename + std::string("'."));
+			return;
+		}
 		std::ifstream in(filename);
-		in >> board;
+		if(detectFormat(in) == GRID){
+			in >> board;
+		} else if(!readLine(in, board)){
+			throw std::invalid_argument(std::string("No board in file: '") + filename + std::string("'."));
+		}
 	}
-	
-	void saveToFile(std::string filename, const Sudoku::Board& board){
+
+	void saveToFile(std::string filename, const Sudoku::Board& board, Format format){
+		if(format == BINARY){
+			BinaryPuzzleWriter writer(filename);
+			writer.write(board);
+			writer.close();
+			return;
+		}
 		std::ofstream out(filename);
-		out << board;
+		if(format == LINE)
+			writeLine(out, board);
+		else
+			out << board;
+	}
+
+	Format detectFormat(std::istream& in){
+		int ch = in.peek();
+		return ch == ' ' || ch == '-' || ch == '|' ? GRID : LINE;
+	}
+
+	// cell value of every character of the line format, INVALID_CHAR for characters that are not allowed
+	static const char INVALID_CHAR = '\x7f';
+
+	static std::array<char, 256> buildLineCharTable(){
+		std::array<char, 256> table;
+		table.fill(INVALID_CHAR);
+		table['.'] = Constants::EMPTY_CELL;
+		table['0'] = Constants::EMPTY_CELL;
+		for(int k=0; k<BOARD_SIZE; k++)
+			table[static_cast<unsigned char>(Constants::ALPHABET[k])] = Constants::ALPHABET[k];
+		return table;
+	}
+
+	static const std::array<char, 256> LINE_CHAR = buildLineCharTable();
+
+	void parseLine(const char* line, size_t length, Sudoku::Board& board){
+		if(length != BOARD_SIZE*BOARD_SIZE)
+			throw std::invalid_argument(std::string("Invalid board line length: '") + std::string(line, length) + std::string("'."));
+		for(int i=0; i<BOARD_SIZE; i++){
+			char* row = board[i];
+			const char* src = line + i*BOARD_SIZE;
+			char invalid = 0;
+			for(int j=0; j<BOARD_SIZE; j++){
+				char ch = LINE_CHAR[static_cast<unsigned char>(src[j])];
+				invalid |= ch == INVALID_CHAR;
+				row[j] = ch;
+			}
+			if(invalid)
+				throw std::invalid_argument(std::string("Invalid character in board line: '") + std::string(line, length) + std::string("'."));
+		}
+	}
+
+	void parseLine(const std::string& line, Sudoku::Board& board){
+		parseLine(line.data(), line.size(), board);
+	}
+
+	bool readLine(std::istream& in, Sudoku::Board& board){
+		std::string line;
+		do{
+			if(!std::getline(in, line))
+				return false;
+			if(!line.empty() && line.back() == '\r')
+				line.pop_back();
+		} while(line.empty());
+		parseLine(line, board);
+		return true;
+	}
+
+	void writeLine(std::ostream& out, const Sudoku::Board& board){
+		char line[BOARD_SIZE*BOARD_SIZE + 1];
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++)
+				line[i*BOARD_SIZE + j] = board[i][j] == Constants::EMPTY_CELL ? '.' : board[i][j];
+		}
+		line[BOARD_SIZE*BOARD_SIZE] = '\n';
+		out.write(line, sizeof(line));
 	}
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <iostream>
 #include "../Sudoku/Board.hpp"
 
 /**
@@ -15,10 +16,22 @@
  */
 namespace FileIO{
     /**
-     * @brief Loads a board from a file.
+     * @brief Formats a board can be stored in.
+     */
+    enum Format{
+        GRID, /**< Human readable grid, one row of cells per line with delimiter lines between them. */
+        LINE, /**< The whole board on a single line, see parseLine. About 4 times smaller than GRID. */
+        BINARY /**< Packed binary puzzle file, see BinaryFormat.hpp. */
+    };
+
+    /**
+     * @brief Loads a board from a file. The format of the file is detected from its first bytes.
+     * 
+     * @details The first board is loaded from a BINARY file.
      * 
      * @param filename Path to the file.
      * @param board Board to load the data into.
+     * @throw std::invalid_argument if the file is in the LINE or BINARY format and does not hold a valid board
      */
 	void loadFromFile(std::string filename, Sudoku::Board& board);
 
@@ -27,6 +40,57 @@ namespace FileIO{
      * 
      * @param filename Path to the file.
      * @param board Board to save.
+     * @param format Format the board is written in.
+     * @throw std::invalid_argument if the format is BINARY and the file cannot be created or the board holds a character outside of the alphabet
+     * @throw std::runtime_error if the format is BINARY and the board cannot be written
+     */
+	void saveToFile(std::string filename, const Sudoku::Board& board, Format format = GRID);
+
+    /**
+     * @brief Detects the text format of the board at the current position of a stream without extracting anything.
+     * 
+     * @param in The stream to inspect.
+     * @return GRID if the next character starts a grid row or delimiter line, LINE otherwise.
+     */
+	Format detectFormat(std::istream& in);
+
+    /**
+     * @brief Parses a board written in the line format.
+     * 
+     * @details In the line format every board is a single line of BOARD_SIZE*BOARD_SIZE characters in row-major order,
+     * with the values of the alphabet for filled cells and '.' or '0' for empty cells.
+     * 
+     * @param line The line to parse, without the line terminator.
+     * @param board Board to load the data into.
+     * @throw std::invalid_argument if the line is not a valid board
+     */
+	void parseLine(const std::string& line, Sudoku::Board& board);
+
+    /**
+     * @brief Parses a board written in the line format from a character range that is not null terminated.
+     * 
+     * @param line The first character of the line.
+     * @param length The length of the line, without the line terminator.
+     * @param board Board to load the data into.
+     * @throw std::invalid_argument if the line is not a valid board
+     */
+	void parseLine(const char* line, size_t length, Sudoku::Board& board);
+
+    /**
+     * @brief Reads the next board written in the line format from a stream. Empty lines are skipped.
+     * 
+     * @param in The stream to read from.
+     * @param board Board to load the data into.
+     * @return false if the end of the stream was reached before a board was read, true otherwise.
+     * @throw std::invalid_argument if the line is not a valid board
+     */
+	bool readLine(std::istream& in, Sudoku::Board& board);
+
+    /**
+     * @brief Writes a board to a stream in the line format, followed by a newline.
+     * 
+     * @param out The stream to write to.
+     * @param board Board to write. Empty cells are written as '.'.
      */
-	void saveToFile(std::string filename, const Sudoku::Board& board);
+	void writeLine(std::ostream& out, const Sudoku::Board& board);
 }
\ No newline at end of file
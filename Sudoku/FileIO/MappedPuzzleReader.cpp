@@ -0,0 +1,124 @@
+/**
+ * @file MappedPuzzleReader.cpp
+ * @brief Implements the MappedPuzzleReader with the memory mapping API of the platform.
+ * @author Nikola Jolovic
+ * @date 18.10.2026
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include "MappedPuzzleReader.hpp"
+#include "FileIO.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FileIO{
+#if defined(_WIN32)
+	MappedPuzzleReader::MappedPuzzleReader(const std::string& filename)
+		: begin(nullptr), end(nullptr), pos(nullptr), file_handle(INVALID_HANDLE_VALUE), mapping_handle(nullptr)
+	{
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if(file == INVALID_HANDLE_VALUE)
+			throw std::invalid_argument(std::string("Cannot open file: '") + filename + std::string("'."));
+		LARGE_INTEGER file_size;
+		if(!GetFileSizeEx(file, &file_size)){
+			CloseHandle(file);
+			throw std::invalid_argument(std::string("Cannot read the size of file: '") + filename + std::string("'."));
+		}
+		this->file_handle = file;
+		if(file_size.QuadPart == 0)
+			return; // empty files cannot be mapped
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if(!view){
+			if(mapping)
+				CloseHandle(mapping);
+			CloseHandle(file);
+			throw std::invalid_argument(std::string("Cannot map file: '") + filename + std::string("'."));
+		}
+		this->mapping_handle = mapping;
+		this->begin = this->pos = static_cast<const char*>(view);
+		this->end = this->begin + static_cast<size_t>(file_size.QuadPart);
+	}
+
+	MappedPuzzleReader::~MappedPuzzleReader(){
+		if(this->begin)
+			UnmapViewOfFile(this->begin);
+		if(this->mapping_handle)
+			CloseHandle(this->mapping_handle);
+		if(this->file_handle != INVALID_HANDLE_VALUE)
+			CloseHandle(this->file_handle);
+	}
+#else
+	MappedPuzzleReader::MappedPuzzleReader(const std::string& filename)
+		: begin(nullptr), end(nullptr), pos(nullptr)
+	{
+		int fd = open(filename.c_str(), O_RDONLY);
+		if(fd < 0)
+			throw std::invalid_argument(std::string("Cannot open file: '") + filename + std::string("'."));
+		struct stat st;
+		if(fstat(fd, &st) != 0){
+			close(fd);
+			throw std::invalid_argument(std::string("Cannot read the size of file: '") + filename + std::string("'."));
+		}
+		if(st.st_size > 0){ // empty files cannot be mapped
+			void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if(view == MAP_FAILED){
+				close(fd);
+				throw std::invalid_argument(std::string("Cannot map file: '") + filename + std::string("'."));
+			}
+			madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+			this->begin = this->pos = static_cast<const char*>(view);
+			this->end = this->begin + static_cast<size_t>(st.st_size);
+		}
+		close(fd); // the mapping keeps the file referenced
+	}
+
+	MappedPuzzleReader::~MappedPuzzleReader(){
+		if(this->begin)
+			munmap(const_cast<char*>(this->begin), this->size());
+	}
+#endif
+
+	bool MappedPuzzleReader::nextLine(const char*& line, size_t& length){
+		if(this->pos == this->end)
+			return false;
+		const char* newline = static_cast<const char*>(std::memchr(this->pos, '\n', this->end - this->pos));
+		const char* line_end = newline ? newline : this->end;
+		line = this->pos;
+		length = line_end - this->pos;
+		if(length > 0 && line[length-1] == '\r')
+			length--;
+		this->pos = newline ? newline + 1 : this->end;
+		return true;
+	}
+
+	bool MappedPuzzleReader::next(Sudoku::Board& board){
+		const char* line;
+		size_t length;
+		do{
+			if(!this->nextLine(line, length))
+				return false;
+		} while(length == 0);
+		parseLine(line, length, board);
+		return true;
+	}
+
+	void MappedPuzzleReader::rewind(){
+		this->pos = this->begin;
+	}
+
+	size_t MappedPuzzleReader::size() const {
+		return this->end - this->begin;
+	}
+}
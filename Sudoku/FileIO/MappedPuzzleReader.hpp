@@ -0,0 +1,75 @@
+/**
+ * @file MappedPuzzleReader.hpp
+ * @brief Defines the MappedPuzzleReader class.
+ * @author Nikola Jolovic
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "../Sudoku/Board.hpp"
+
+namespace FileIO{
+    /**
+     * @brief Reads a file of boards in the line format by mapping it into memory.
+     * 
+     * @details The whole file is mapped read-only once, lines are returned as pointers into the mapping
+     * and boards are parsed straight from it, so no stream or per-line string is involved.
+     * The mapping lives as long as the reader, every line view is invalidated when the reader is destroyed.
+     */
+	class MappedPuzzleReader{
+	public:
+        /**
+         * @brief Constructor. Maps the file into memory.
+         * @param filename Path to the file.
+         * @throw std::invalid_argument if the file cannot be opened or mapped
+         */
+		MappedPuzzleReader(const std::string& filename);
+
+        /**
+         * @brief Destructor. Unmaps the file.
+         */
+		~MappedPuzzleReader();
+
+		MappedPuzzleReader(const MappedPuzzleReader&) = delete;
+		MappedPuzzleReader& operator=(const MappedPuzzleReader&) = delete;
+
+        /**
+         * @brief Returns the next line of the file, including empty ones.
+         * @param line Set to the first character of the line.
+         * @param length Set to the length of the line, without the line terminator ("\n" or "\r\n").
+         * @return false if the end of the file was reached, true otherwise.
+         */
+		bool nextLine(const char*& line, size_t& length);
+
+        /**
+         * @brief Parses the next board of the file. Empty lines are skipped.
+         * @param board Board to load the data into.
+         * @return false if the end of the file was reached before a board was read, true otherwise.
+         * @throw std::invalid_argument if the line is not a valid board
+         */
+		bool next(Sudoku::Board& board);
+
+        /**
+         * @brief Moves back to the first line of the file.
+         */
+		void rewind();
+
+        /**
+         * @brief Getter for the size of the file.
+         * @return The size of the file in bytes.
+         */
+		size_t size() const;
+
+	private:
+		const char* begin; /**< First byte of the mapping. nullptr for an empty file. */
+		const char* end; /**< One past the last byte of the mapping. */
+		const char* pos; /**< Start of the next line. */
+#if defined(_WIN32)
+		void* file_handle; /**< Handle of the opened file. */
+		void* mapping_handle; /**< Handle of the file mapping object. */
+#endif
+	};
+}
@@ -5,11 +5,13 @@
 * @date 26.12.2023
 */
 
+#include <atomic>
 #include <bitset>
 #include <vector>
 #include <algorithm>
-#include <ctime>
-#include <stack>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
 #include <utility>
 #include "SudokuGenerator.hpp"
 #include "../Sudoku/Board.hpp"
@@ -17,10 +19,16 @@
 #include "../Constants.hpp"
 
 namespace Sudoku{
-	SudokuGenerator::SudokuGenerator() : difficulty(MEDIUM), unique(false), random_gen(time(0)) {}
+	SudokuGenerator::SudokuGenerator() : unique(false), difficulty(MEDIUM), uniqueness_check(ALTERNATIVE_SEARCH),
+		  grade_targeted(false), target_grade(SIMPLE), max_attempts(1), budget(nullptr), stats(nullptr), solver(BACKTRACKING) {
+		this->setSeed(randomSeed());
+	}
 
 	SudokuGenerator::SudokuGenerator(Difficulty difficulty=MEDIUM, bool unique=false)
-		: difficulty(difficulty), unique(unique), random_gen(time(0)) {}
+		: unique(unique), difficulty(difficulty), uniqueness_check(ALTERNATIVE_SEARCH),
+		  grade_targeted(false), target_grade(SIMPLE), max_attempts(1), budget(nullptr), stats(nullptr), solver(BACKTRACKING) {
+		this->setSeed(randomSeed());
+	}
 
 	void SudokuGenerator::setDifficulty(Difficulty difficulty){
 		this->difficulty = difficulty;
@@ -30,45 +38,168 @@ namespace Sudoku{
 		this->unique = unique;
 	}
 
-	void SudokuGenerator::fillBoard(Board& board){
-		MarkedBoard marked_board = board;
-		this->fillBoardFrom(marked_board, 0, 0);
-		board = marked_board;
+	void SudokuGenerator::setTargetGrade(Grade grade, int max_attempts){
+		if(max_attempts < 1){
+			throw std::invalid_argument("The generator needs at least one attempt per board.");
+		}
+		this->grade_targeted = true;
+		this->target_grade = grade;
+		this->max_attempts = max_attempts;
+	}
+
+	void SudokuGenerator::clearTargetGrade(){
+		this->grade_targeted = false;
+	}
+
+	void SudokuGenerator::setSolverEngine(SolverEngine engine){
+		this->solver.setEngine(engine);
+		for(std::unique_ptr<CheckWorker>& worker : this->check_workers)
+			worker->solver.setEngine(engine);
+	}
+
+	void SudokuGenerator::setUniquenessCheck(UniquenessCheck check){
+		this->uniqueness_check = check;
+	}
+
+	void SudokuGenerator::setThreadCount(int thread_count){
+		this->check_workers.clear();
+		this->pool.reset(new WorkStealingPool(thread_count));
+		if(this->pool->getWorkerCount() == 1){
+			this->pool.reset();
+			return;
+		}
+		for(int w=0; w<this->pool->getWorkerCount(); w++){
+			this->check_workers.emplace_back(new CheckWorker());
+			this->check_workers.back()->solver.setEngine(this->solver.getEngine());
+		}
+	}
+
+	void SudokuGenerator::setSeed(uint64_t seed){
+		this->random_gen.seed(seed);
+	}
+
+	uint64_t SudokuGenerator::deriveSeed(uint64_t base_seed, uint64_t index){
+		uint64_t z = base_seed + (index + 1) * 0x9E3779B97F4A7C15ull;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	uint64_t SudokuGenerator::randomSeed(){
+		std::random_device device;
+		uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+		// some std::random_device implementations are deterministic, the clock still separates the runs
+		return deriveSeed(seed, static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+	}
+
+	template<int BlockSize>
+	bool SudokuGenerator::fillBoard(BasicBoard<BlockSize>& board){
+		const BasicMarkedBoard<BlockSize> start = board;
+		for(int attempt=0; attempt<FILL_ATTEMPTS; attempt++){
+			// a randomized fill that gets stuck can take arbitrarily long, a fresh shuffle almost always finishes fast
+			SearchBudget attempt_budget;
+			attempt_budget.setNodeLimit(FILL_NODE_LIMIT * BoardTraits<BlockSize>::CELL_COUNT);
+			BasicMarkedBoard<BlockSize> marked_board = start;
+			if(this->fillBoardFrom(marked_board, 0, 0, attempt_budget)){
+				board = marked_board;
+				return true;
+			}
+			// the board has no solution or the budget of the caller ran out
+			if(!attempt_budget.exhausted() || (this->budget && this->budget->exhausted()))
+				return false;
+		}
+		return false;
 	}
 
-	bool SudokuGenerator::fillBoardFrom(MarkedBoard& board, int ri, int ci){
-		while(ri < BOARD_SIZE && board[ri][ci] != Constants::EMPTY_CELL){
-			if(++ci == BOARD_SIZE){
-				ci = 0;
-				ri++;
+	template<int BlockSize>
+	bool SudokuGenerator::fillBoardFrom(BasicMarkedBoard<BlockSize>& board, int ri, int ci, SearchBudget& attempt_budget){
+		const int size = BoardTraits<BlockSize>::BOARD_SIZE;
+		if(size > 16){
+			// reading order gets lost in dead ends on 25x25 boards, they are filled the most constrained cell first
+			if(!board.findMostConstrainedCell(ri, ci)) return true;
+		} else {
+			while(ri < size && board[ri][ci] != Constants::EMPTY_CELL){
+				if(++ci == size){
+					ci = 0;
+					ri++;
+				}
 			}
+			if(ri == size) return true;
 		}
-		if(ri == BOARD_SIZE) return true;
-		std::bitset<BOARD_SIZE> taken =
-			board.rowSets[ri] | board.colSets[ci] | board.blockSets[Board::getBlockNum(ri, ci)];
+		if((this->budget && !this->budget->tick()) || !attempt_budget.tick()) return false;
+		std::bitset<size> taken =
+			board.rowSets[ri] | board.colSets[ci] | board.blockSets[BasicBoard<BlockSize>::getBlockNum(ri, ci)];
 		std::vector<int> possible;
-		for(int k=0; k<BOARD_SIZE; k++){
+		for(int k=0; k<size; k++){
 			if(!taken.test(k))
 				possible.push_back(k);
 		}
-		std::shuffle(possible.begin(), possible.end(), this->random_gen);
+		this->shuffle(possible);
 		for(int k : possible){
-			board[ri][ci] = Constants::ALPHABET[k];
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = true;
-			if(this->fillBoardFrom(board, ri, ci))
+			board.placeValue(ri, ci, k);
+			if(this->fillBoardFrom(board, ri, ci, attempt_budget))
 				return true;
-			board[ri][ci] = Constants::EMPTY_CELL;
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = false;
+			board.removeValue(ri, ci, k);
 		}
 		return false;
 	}
 
-	int SudokuGenerator::randomIndex(){
-		return this->random_gen() % Constants::BOARD_SIZE;
+	int SudokuGenerator::maxClearedCells(Difficulty difficulty, int cell_count){
+		const int classic_cells = Constants::BOARD_SIZE * Constants::BOARD_SIZE;
+		if(difficulty == EASY)
+			return 30 * cell_count / classic_cells;
+		if(difficulty == MEDIUM)
+			return 50 * cell_count / classic_cells;
+		return 64 * cell_count / classic_cells;
+	}
+
+	uint32_t SudokuGenerator::randomBelow(uint32_t bound){
+		// the high 32 bits times the bound, the low half of the product decides whether the draw is biased
+		uint64_t product = (this->random_gen() >> 32) * bound;
+		uint32_t low = static_cast<uint32_t>(product);
+		if(low < bound){
+			uint32_t threshold = (0u - bound) % bound;
+			while(low < threshold){
+				product = (this->random_gen() >> 32) * bound;
+				low = static_cast<uint32_t>(product);
+			}
+		}
+		return static_cast<uint32_t>(product >> 32);
+	}
+
+	void SudokuGenerator::shuffle(std::vector<int>& values){
+		for(size_t i=values.size(); i>1; i--)
+			std::swap(values[i - 1], values[this->randomBelow(static_cast<uint32_t>(i))]);
 	}
 
 	void SudokuGenerator::generateBoard(Board& board){
-		this->fillBoard(board);
+		if(!this->grade_targeted){
+			this->generateAttempt(board);
+			return;
+		}
+		Board start = board, attempt;
+		int best_distance = -1;
+		for(int a=0; a<this->max_attempts && best_distance != 0; a++){
+			attempt = start;
+			if(!this->generateAttempt(attempt))
+				break;
+			Clock::time_point begin = Clock::now();
+			int distance = std::abs(int(this->grader.grade(attempt).grade) - int(this->target_grade));
+			if(this->stats)
+				this->stats->grading_time += Clock::now() - begin;
+			if(best_distance < 0 || distance < best_distance){
+				best_distance = distance;
+				board = attempt;
+			}
+			if(this->budget && this->budget->exhausted())
+				break;
+		}
+	}
+
+	template<int BlockSize>
+	void SudokuGenerator::generateBoard(BasicBoard<BlockSize>& board){
+		if(!this->fillBoard(board))
+			return;
 		if(this->unique){
 			this->generateUnique(board);
 		} else {
@@ -76,101 +207,227 @@ namespace Sudoku{
 		}
 	}
 
-	void SudokuGenerator::generate(Board& board){
-		int cells_to_clear = 0;
+	bool SudokuGenerator::generateBoard(Board& board, SearchBudget& budget, GenerationStats& stats){
+		stats = GenerationStats();
+		this->budget = &budget;
+		this->stats = &stats;
+		this->solver.setSearchBudget(&budget);
+		this->generateBoard(board);
+		this->solver.setSearchBudget(nullptr);
+		this->budget = nullptr;
+		this->stats = nullptr;
+		stats.complete = !budget.exhausted();
+		return stats.complete;
+	}
+
+	bool SudokuGenerator::generateAttempt(Board& board){
+		Clock::time_point begin = Clock::now();
+		uint64_t nodes = this->budget ? this->budget->getNodes() : 0;
+		bool filled = this->fillBoard(board);
+		if(this->stats){
+			this->stats->attempts++;
+			this->stats->fill_time += Clock::now() - begin;
+			this->stats->fill_nodes += this->budget->getNodes() - nodes;
+		}
+		if(!filled)
+			return false;
+
+		begin = Clock::now();
+		nodes = this->budget ? this->budget->getNodes() : 0;
+		Clock::duration grading_time = this->stats ? this->stats->grading_time : Clock::duration::zero();
+		if(this->unique){
+			this->generateUnique(board);
+		} else {
+			this->generate(board);
+		}
+		if(this->stats){
+			// the prefix search of a target grade is timed as grading
+			this->stats->removal_time += (Clock::now() - begin) - (this->stats->grading_time - grading_time);
+			this->stats->check_nodes += this->budget->getNodes() - nodes;
+		}
+		return true;
+	}
+
+	template<int BlockSize>
+	void SudokuGenerator::generate(BasicBoard<BlockSize>& board){
+		const int size = BoardTraits<BlockSize>::BOARD_SIZE, cells = BoardTraits<BlockSize>::CELL_COUNT;
+		int lowest = 0, highest = 0;
 		if(this->difficulty == EASY){
-			std::uniform_int_distribution<int> dist(10, 30);
-			cells_to_clear = dist(this->random_gen);
+			lowest = 10 * cells / (Constants::BOARD_SIZE * Constants::BOARD_SIZE);
+			highest = maxClearedCells(EASY, cells);
 		} else if(this->difficulty == MEDIUM){
-			std::uniform_int_distribution<int> dist(31, 50);
-			cells_to_clear = dist(this->random_gen);
+			lowest = maxClearedCells(EASY, cells) + 1;
+			highest = maxClearedCells(MEDIUM, cells);
 		} else {
-			std::uniform_int_distribution<int> dist(51, 64);
-			cells_to_clear = dist(this->random_gen);
+			lowest = maxClearedCells(MEDIUM, cells) + 1;
+			highest = maxClearedCells(HARD, cells);
 		}
+		int cells_to_clear = lowest + static_cast<int>(this->randomBelow(static_cast<uint32_t>(highest - lowest + 1)));
 		for(int _=0; _<cells_to_clear; _++){
 			int row, col;
 			do{
-				row = random_gen() % Constants::BOARD_SIZE;
-				col = random_gen() % Constants::BOARD_SIZE;
+				row = static_cast<int>(this->randomBelow(size));
+				col = static_cast<int>(this->randomBelow(size));
 			} while(board[row][col] == Constants::EMPTY_CELL);
 			board[row][col] = Constants::EMPTY_CELL;
 		}
 	}
 
-	int SudokuGenerator::solutionCount(MarkedBoard& board, int ri=0, int ci=0){
-		while(ri < BOARD_SIZE && board[ri][ci] != Constants::EMPTY_CELL){
-			if(++ci == BOARD_SIZE){
-				ci = 0;
-				ri++;
+	bool SudokuGenerator::hasAlternativeSolution(MarkedBoard& board, int rowIdx, int colIdx, int k){
+		std::bitset<BOARD_SIZE> candidates = board.getCandidates(rowIdx, colIdx);
+		if(this->stats)
+			this->stats->uniqueness_checks++;
+		if(this->uniqueness_check == SOLUTION_COUNT){
+			if(!this->dancing_links)
+				this->dancing_links.reset(new DancingLinks());
+			// a count cut short by the budget is discarded by the caller
+			this->dancing_links->setSearchBudget(this->budget);
+			int solution_cnt = this->dancing_links->countSolutions(board, 2);
+			this->dancing_links->setSearchBudget(nullptr);
+			return solution_cnt > 1;
+		}
+		// a budget counts the nodes of a single thread, so budgeted checks stay on the calling thread
+		if(this->pool && !this->budget && candidates.count() > 2){
+			int alternatives[BOARD_SIZE];
+			int alternative_cnt = 0;
+			for(int alt=0; alt<BOARD_SIZE; alt++){
+				if(alt != k && candidates.test(alt))
+					alternatives[alternative_cnt++] = alt;
 			}
+			// the board is only read while the pool runs, every worker searches its own copy
+			std::atomic<bool> found(false);
+			this->pool->run(alternative_cnt, [&](int w, int t){
+				if(found.load(std::memory_order_relaxed))
+					return;
+				CheckWorker& worker = *this->check_workers[w];
+				worker.board = board;
+				worker.board.placeValue(rowIdx, colIdx, alternatives[t]);
+				worker.solver.setCancelFlag(&found);
+				if(worker.solver.solve(worker.board, worker.scratch_board))
+					found.store(true, std::memory_order_relaxed);
+				worker.solver.setCancelFlag(nullptr);
+			});
+			return found.load();
 		}
-		if(ri == BOARD_SIZE) return 1;
-		int solution_cnt = 0;
-		std::bitset<BOARD_SIZE> taken =
-			board.rowSets[ri] | board.colSets[ci] | board.blockSets[Board::getBlockNum(ri, ci)];
-		for(int k=0; k<BOARD_SIZE; k++){
-			if(taken.test(k))
+		for(int alt=0; alt<BOARD_SIZE; alt++){
+			if(alt == k || !candidates.test(alt))
 				continue;
-			board[ri][ci] = Constants::ALPHABET[k];
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = true;
-			solution_cnt += this->solutionCount(board, ri, ci);
+			board.placeValue(rowIdx, colIdx, alt);
+			bool solvable = this->solver.solve(board, this->scratch_board);
+			board.removeValue(rowIdx, colIdx, alt);
+			if(solvable)
+				return true;
+		}
+		return false;
+	}
 
-			// IMPORTANT: This line ensures that at most 2 solutions are ever calculated.
-			if(solution_cnt > 1) break;
-			
-			board[ri][ci] = Constants::EMPTY_CELL;
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = false;
+	template<int BlockSize>
+	bool SudokuGenerator::hasAlternativeSolution(BasicMarkedBoard<BlockSize>& board, int rowIdx, int colIdx, int k){
+		std::bitset<BoardTraits<BlockSize>::BOARD_SIZE> candidates = board.getCandidates(rowIdx, colIdx);
+		if(this->stats)
+			this->stats->uniqueness_checks++;
+		// proving that no alternative exists can take exponentially long on the bigger boards, so an undecided check keeps the value
+		SearchBudget check_budget;
+		check_budget.setNodeLimit(CHECK_NODE_LIMIT);
+		BasicBitboardSolver<BlockSize> bitboard_solver;
+		BasicBoard<BlockSize> solution;
+		for(int alt=0; alt<BoardTraits<BlockSize>::BOARD_SIZE; alt++){
+			if(alt == k || !candidates.test(alt))
+				continue;
+			board.placeValue(rowIdx, colIdx, alt);
+			bool solvable = bitboard_solver.solve(board, solution, nullptr, &check_budget);
+			board.removeValue(rowIdx, colIdx, alt);
+			if(solvable || check_budget.exhausted())
+				return true;
 		}
-		return solution_cnt;
+		return false;
 	}
 
-	void SudokuGenerator::generateUnique(Board& board){
-		MarkedBoard marked_board = board;
-		std::stack<std::pair<int, int>> removals;
-		for(int _=0; _<64; _++){ // 9x9 boards with less than 17 values are guaranteed to have multiple solutions
+	template<int BlockSize>
+	void SudokuGenerator::findRemovals(const BasicBoard<BlockSize>& board, std::vector<std::pair<int, int>>& removals){
+		typedef BoardTraits<BlockSize> Traits;
+		BasicMarkedBoard<BlockSize> marked_board = board;
+		removals.clear();
+		// 9x9 boards with less than 17 values are guaranteed to have multiple solutions
+		for(int _=0; _<maxClearedCells(HARD, Traits::CELL_COUNT); _++){
 			int row, col;
 			do{
-				row = random_gen() % Constants::BOARD_SIZE;
-				col = random_gen() % Constants::BOARD_SIZE;
+				row = static_cast<int>(this->randomBelow(Traits::BOARD_SIZE));
+				col = static_cast<int>(this->randomBelow(Traits::BOARD_SIZE));
 			} while(marked_board[row][col] == Constants::EMPTY_CELL);
 
 			char value = marked_board[row][col];
-			int idx = Constants::KEY_IDX.at(value);
-			
-			marked_board[row][col] = Constants::EMPTY_CELL;
-			marked_board.rowSets[row][idx] = marked_board.colSets[col][idx] = marked_board.blockSets[MarkedBoard::getBlockNum(row, col)][idx] = false;
-			removals.push(std::make_pair(row, col));
+			int idx = Traits::index(value);
 			
-			if(removals.size() < 45) // Impossible to have multiple solutions on a 9x9 board.
-				continue;
+			marked_board.removeValue(row, col, idx);
+			removals.push_back(std::make_pair(row, col));
 			
-			int sol_cnt = this->solutionCount(marked_board);
-			if(sol_cnt > 1){
-				marked_board[row][col] = value;
-				marked_board.rowSets[row][idx] = marked_board.colSets[col][idx] = marked_board.blockSets[MarkedBoard::getBlockNum(row, col)][idx] = true;
-				removals.pop();
-			} else if(sol_cnt < 1){
-				marked_board[row][col] = value;
-				marked_board.rowSets[row][idx] = marked_board.colSets[col][idx] = marked_board.blockSets[MarkedBoard::getBlockNum(row, col)][idx] = true;
-				removals.pop();
-				break;
+			// The board still has the filled solution, so it stays unique unless a solution with another value in the cleared cell exists.
+			// Every removal is checked: a board with only a few dozen empty cells can already have multiple solutions.
+			bool ambiguous = this->hasAlternativeSolution(marked_board, row, col, idx);
+			// an exhausted budget ends the search early, so the last removal was not verified
+			if(ambiguous || (this->budget && this->budget->exhausted())){
+				marked_board.placeValue(row, col, idx);
+				removals.pop_back();
 			}
+			if(this->budget && !this->budget->poll())
+				break;
 		}
-		size_t undo_cnt = 0;
-		if(this->difficulty == EASY){
-			undo_cnt = removals.size() / 2;
-		} else if(this->difficulty == MEDIUM){
-			undo_cnt = removals.size() / 4;
-		}
-		while(undo_cnt--){
-			removals.pop();
+	}
+
+	size_t SudokuGenerator::keptRemovals(size_t removal_cnt, int cell_count) const {
+		if(this->budget && this->budget->exhausted()){
+			// the best board found so far keeps the verified removals, up to the most the difficulty clears
+			return std::min(removal_cnt, static_cast<size_t>(maxClearedCells(this->difficulty, cell_count)));
 		}
-		while(!removals.empty()){
-			std::pair<int, int> p = removals.top();
-			removals.pop();
-			int row = p.first, col = p.second;
-			board[row][col] = Constants::EMPTY_CELL;
+		if(this->difficulty == EASY)
+			return removal_cnt - removal_cnt / 2;
+		if(this->difficulty == MEDIUM)
+			return removal_cnt - removal_cnt / 4;
+		return removal_cnt;
+	}
+
+	template<int BlockSize>
+	void SudokuGenerator::generateUnique(BasicBoard<BlockSize>& board){
+		std::vector<std::pair<int, int>> removals;
+		this->findRemovals(board, removals);
+		size_t keep_cnt = this->keptRemovals(removals.size(), BoardTraits<BlockSize>::CELL_COUNT);
+		for(size_t r=0; r<keep_cnt; r++)
+			board[removals[r].first][removals[r].second] = Constants::EMPTY_CELL;
+	}
+
+	void SudokuGenerator::generateUnique(Board& board){
+		std::vector<std::pair<int, int>> removals;
+		this->findRemovals(board, removals);
+		size_t keep_cnt = removals.size();
+		if(this->grade_targeted){
+			Clock::time_point begin = Clock::now();
+			// more removals rarely make a board easier, so search for the longest prefix within the target grade
+			Board prefix_board;
+			size_t lo = 0, hi = removals.size();
+			while(lo < hi){
+				size_t mid = (lo + hi + 1) / 2;
+				prefix_board = board;
+				for(size_t r=0; r<mid; r++)
+					prefix_board[removals[r].first][removals[r].second] = Constants::EMPTY_CELL;
+				if(this->grader.grade(prefix_board).grade <= this->target_grade){
+					lo = mid;
+				} else {
+					hi = mid - 1;
+				}
+			}
+			keep_cnt = lo;
+			if(this->stats)
+				this->stats->grading_time += Clock::now() - begin;
+		} else {
+			keep_cnt = this->keptRemovals(removals.size(), Constants::BOARD_SIZE * Constants::BOARD_SIZE);
 		}
+		for(size_t r=0; r<keep_cnt; r++)
+			board[removals[r].first][removals[r].second] = Constants::EMPTY_CELL;
 	}
+
+	// the sizes other than 9x9 are compiled here, 9x9 boards take the non-template overloads
+	template void SudokuGenerator::generateBoard(BasicBoard<2>& board);
+	template void SudokuGenerator::generateBoard(BasicBoard<4>& board);
+	template void SudokuGenerator::generateBoard(BasicBoard<5>& board);
 }
\ No newline at end of file
@@ -7,9 +7,20 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <random>
+#include <utility>
+#include <vector>
 #include "../Sudoku/Board.hpp"
 #include "../Sudoku/MarkedBoard.hpp"
+#include "../Solver/SudokuSolver.hpp"
+#include "../Solver/BitboardSolver.hpp"
+#include "../Solver/DancingLinks.hpp"
+#include "../Solver/SearchBudget.hpp"
+#include "../Batch/WorkStealingPool.hpp"
+#include "../Grader/TechniqueGrader.hpp"
 
 namespace Sudoku{
     /**
@@ -19,6 +30,28 @@ namespace Sudoku{
 		EASY, MEDIUM, HARD
 	};
 
+    /**
+     * @brief Ways of checking that a cleared value keeps the solution of a unique board unique.
+     */
+	enum UniquenessCheck{
+		ALTERNATIVE_SEARCH, /**< Searches for a solution with another value in the cleared cell, with the engine of setSolverEngine. */
+		SOLUTION_COUNT /**< Counts up to two solutions of the whole board with DancingLinks::countSolutions. */
+	};
+
+    /**
+     * @brief Work done by a budgeted SudokuGenerator::generateBoard call.
+     */
+    struct GenerationStats {
+        bool complete = true; /**< False if the budget ran out and the board is the best one found so far. */
+        int attempts = 0; /**< Number of boards started, more than one only with a target grade. */
+        int uniqueness_checks = 0; /**< Number of removals checked for an alternative solution. */
+        uint64_t fill_nodes = 0; /**< Search nodes spent filling the boards. */
+        uint64_t check_nodes = 0; /**< Search nodes spent by the uniqueness checks. */
+        std::chrono::steady_clock::duration fill_time = std::chrono::steady_clock::duration::zero(); /**< Time spent filling the boards. */
+        std::chrono::steady_clock::duration removal_time = std::chrono::steady_clock::duration::zero(); /**< Time spent clearing cells, uniqueness checks included. */
+        std::chrono::steady_clock::duration grading_time = std::chrono::steady_clock::duration::zero(); /**< Time spent grading the boards for a target grade. */
+    };
+
     /**
      * @brief Generates a Sudoku board.
      * 
@@ -30,14 +63,14 @@ namespace Sudoku{
         /**
          * @brief Default constructor.
          * 
-         * Constructs a SudokuGenerator with default values (difficulty=MEDIUM, unique=true)
+         * Constructs a SudokuGenerator with default values (difficulty=MEDIUM, unique=true), seeded with randomSeed().
          */
 		SudokuGenerator();
 
         /**
          * @brief Constructor.
          * 
-         * Constructs a SudokuGenerator with given difficulty level and uniqueness.
+         * Constructs a SudokuGenerator with given difficulty level and uniqueness, seeded with randomSeed().
          * 
          * @param difficulty Difficulty level of the generated Sudoku.
          * @param unique Indicates if the generated solution must be unique.
@@ -53,6 +86,36 @@ namespace Sudoku{
          */
 		void generateBoard(Board& board);
 
+        /**
+         * @brief Fills the given Board with a random Sudoku puzzle within a search budget.
+         * 
+         * Every node of the random fill and of the uniqueness checks is counted against \p budget, so a node limit or a
+         * deadline bounds the whole call. When the budget runs out the board is the best one found so far: a unique
+         * board keeps the removals that were verified before, at most as many as the difficulty clears, and with a target grade the closest complete attempt
+         * is kept. If it runs out before the first board is filled, \p board is left unchanged.
+         * Budgeted uniqueness checks run on the calling thread, whatever the setThreadCount.
+         * 
+         * @param board The Board to be filled.
+         * @param budget The budget of the call. Its nodes keep counting from where they are.
+         * @param stats Receives the nodes, uniqueness checks and time spent in every phase.
+         * @return true if the board was generated within the budget, false if the budget ran out.
+         */
+		bool generateBoard(Board& board, SearchBudget& budget, GenerationStats& stats);
+
+        /**
+         * @brief Fills the given board of any supported size with a random Sudoku puzzle, see BoardTraits.
+         * 
+         * The board is filled and cleared like a 9x9 one, with the cleared cell counts of the difficulty scaled to the
+         * cells of the board. The uniqueness checks run on the calling thread with the BasicBitboardSolver of the size.
+         * The target grade, the solver engine and the thread count only apply to 9x9 boards, which overload resolution
+         * hands to the non-template generateBoard.
+         * 
+         * @tparam BlockSize Number of rows and columns of a block.
+         * @param board The board to be filled.
+         */
+		template<int BlockSize>
+		void generateBoard(BasicBoard<BlockSize>& board);
+
         /**
          * @brief Sets the difficulty level for the Sudoku generation.
          * 
@@ -67,33 +130,180 @@ namespace Sudoku{
          */
         void setUnique(bool unique);
 
+        /**
+         * @brief Sets the solver engine used for the uniqueness checks of unique generation.
+         * 
+         * @param engine The new uniqueness check engine.
+         */
+        void setSolverEngine(SolverEngine engine);
+
+        /**
+         * @brief Sets how unique generation checks the removals of 9x9 boards.
+         * 
+         * Both checks keep the same removals, so the generated boards do not depend on the check. SOLUTION_COUNT is an
+         * independent cross-check of ALTERNATIVE_SEARCH, the default, and always runs on the calling thread.
+         * 
+         * @param check The new uniqueness check.
+         */
+        void setUniquenessCheck(UniquenessCheck check);
+
+        /**
+         * @brief Sets the number of threads of the uniqueness checks.
+         * 
+         * With more than one thread the candidates of a cleared cell are searched concurrently on a WorkStealingPool,
+         * and every search is cancelled as soon as one of them finds a solution. The generated boards do not depend
+         * on the number of threads. Worth it for single boards on many cores, bulk generation is better served by
+         * running independent generators in parallel.
+         * 
+         * @param thread_count The number of threads. 0 uses every hardware thread, 1 checks on the calling thread.
+         */
+        void setThreadCount(int thread_count);
+
+        /**
+         * @brief Reseeds the random number generator.
+         * 
+         * Generators with the same seed, difficulty and uniqueness produce the same boards with every compiler and standard library.
+         * 
+         * @param seed The new seed.
+         */
+        void setSeed(uint64_t seed);
+
+        /**
+         * @brief Makes the generator aim for boards of the given TechniqueGrader grade instead of the difficulty.
+         * 
+         * Unique generation keeps the longest prefix of its removals whose grade does not exceed \p grade. Whenever the
+         * grade of the result misses the target, the whole board is generated again, up to \p max_attempts times, and
+         * the board whose grade is the closest to the target is kept. Boards without a unique solution are graded
+         * as they are, so targeting works best together with unique generation.
+         * 
+         * @param grade The target grade.
+         * @param max_attempts The maximum number of boards generated per call of generateBoard.
+         * @throw std::invalid_argument if \p max_attempts is less than 1
+         */
+        void setTargetGrade(Grade grade, int max_attempts = 64);
+
+        /**
+         * @brief Goes back to generating boards of the set difficulty.
+         */
+        void clearTargetGrade();
+
+        /**
+         * @brief Derives the seed of one item of a seeded sequence, e.g. the n-th board of a generated pack.
+         * 
+         * Mixes \p base_seed and \p index with the SplitMix64 finalizer, so neighbouring indices get unrelated seeds
+         * and the seed of an item does not depend on which generator or thread produces it.
+         * 
+         * @param base_seed The seed of the whole sequence.
+         * @param index The index of the item.
+         * @return The seed of the item.
+         */
+        static uint64_t deriveSeed(uint64_t base_seed, uint64_t index);
+
+        /**
+         * @brief Draws a seed from std::random_device mixed with the current time.
+         * @return A fresh seed.
+         */
+        static uint64_t randomSeed();
+
 	private:
 		bool unique; /**< Indicates if the generated solution must be unique. */
 		Difficulty difficulty; /**< Difficulty level of the generated Sudoku. */
+		UniquenessCheck uniqueness_check; /**< Check of the removals of unique generation. */
+		bool grade_targeted; /**< Indicates if the generator aims for target_grade instead of the difficulty. */
+		Grade target_grade; /**< Grade the generator aims for. */
+		int max_attempts; /**< Maximum number of boards generated while aiming for target_grade. */
+		TechniqueGrader grader; /**< Grades the boards while aiming for target_grade. */
+
+		typedef std::chrono::steady_clock Clock; /**< Clock of the GenerationStats. */
+
+		static const uint64_t FILL_NODE_LIMIT = 8; /**< Nodes per cell of one attempt to fill a board. A stuck attempt restarts with a fresh shuffle. */
+		static const int FILL_ATTEMPTS = 1000; /**< Attempts to fill a board before the generator gives up on it. */
+		static const uint64_t CHECK_NODE_LIMIT = 2000; /**< Nodes of a uniqueness check of a board other than 9x9. A check that runs out keeps the cleared value. */
+
+		SearchBudget* budget; /**< Budget of the running budgeted generateBoard call, or nullptr. */
+		GenerationStats* stats; /**< Stats of the running budgeted generateBoard call, or nullptr. */
+
+		std::mt19937_64 random_gen; /**< Random number generator. Only its raw output is used, which is the same on every standard library. */
 
-		std::mt19937 random_gen; /**< Random number generator. */
+		SudokuSolver solver; /**< Solver used by the uniqueness checks. */
+		MarkedBoard scratch_board; /**< Solution board of the uniqueness checks. Only its existence matters. */
+		std::unique_ptr<DancingLinks> dancing_links; /**< Counts the solutions of the SOLUTION_COUNT checks. Allocated on first use. */
 
-        
-		int randomIndex();
+        /**
+         * @brief State of one thread of the parallel uniqueness checks.
+         */
+		struct CheckWorker {
+			SudokuSolver solver; /**< Solver of the thread. */
+			MarkedBoard board; /**< Copy of the checked board with one candidate placed. */
+			MarkedBoard scratch_board; /**< Solution board of the thread. */
+		};
+
+		std::unique_ptr<WorkStealingPool> pool; /**< Runs the parallel uniqueness checks, nullptr when they run on the calling thread. */
+		std::vector<std::unique_ptr<CheckWorker>> check_workers; /**< One worker per thread of the pool. */
+
+
+        /**
+         * @brief Draws a uniformly distributed number below \p bound with Lemire's multiply and shift method.
+         * 
+         * Unlike std::uniform_int_distribution, the mapping is fixed, so a seed draws the same numbers on every platform.
+         * 
+         * @param bound The exclusive upper bound, greater than 0.
+         * @return A number in [0, bound).
+         */
+		uint32_t randomBelow(uint32_t bound);
+
+        /**
+         * @brief Shuffles the values with the Fisher-Yates algorithm, drawing from randomBelow.
+         * 
+         * Replaces std::shuffle, whose draws differ between standard libraries.
+         * 
+         * @param values The values to be shuffled.
+         */
+		void shuffle(std::vector<int>& values);
+
+        /**
+         * @brief Returns the most cells a board of the given difficulty gets cleared.
+         * 
+         * @param difficulty The difficulty level.
+         * @param cell_count The number of cells of the board, the counts of 9x9 boards are scaled to it.
+         * @return The upper end of the range of cleared cells of the difficulty.
+         */
+		static int maxClearedCells(Difficulty difficulty, int cell_count = Constants::BOARD_SIZE * Constants::BOARD_SIZE);
 
         /**
          * @brief Fills the given Board with a random Sudoku solution.
          * 
+         * Every attempt gets FILL_NODE_LIMIT nodes per cell and restarts with a fresh shuffle when they run out,
+         * so a fill takes at most FILL_ATTEMPTS times as long.
+         * 
          * @param board The Board to be filled.
+         * @return true if the board is filled, false if the budget ran out or the board has no solution. The board is unchanged then.
          */
-		void fillBoard(Board& board);
+		template<int BlockSize>
+		bool fillBoard(BasicBoard<BlockSize>& board);
 
         /**
          * @brief Fills the given MarkedBoard with a random Sudoku solution.
          * 
          * Fills the given MarkedBoard with a random Sudoku solution starting from the given cell.
+         * 25x25 boards are filled the most constrained cell first instead.
          * 
          * @param board The MarkedBoard to be filled.
          * @param rowIdx The row index of the cell to be filled.
          * @param colIdx The column index of the cell to be filled.
+         * @param attempt_budget The node budget of the attempt, counted besides the budget of the generator.
          * @return true if the board is filled, false otherwise.
          */
-		bool fillBoardFrom(MarkedBoard& board, int rowIdx, int colIdx);
+		template<int BlockSize>
+		bool fillBoardFrom(BasicMarkedBoard<BlockSize>& board, int rowIdx, int colIdx, SearchBudget& attempt_budget);
+
+        /**
+         * @brief Fills the given Board with a random solution and clears cells according to the difficulty or the target grade.
+         * 
+         * @param board The Board to be filled.
+         * @return true if the board was filled, false if the budget ran out before. The board is unchanged then.
+         */
+		bool generateAttempt(Board& board);
 
         /**
          * @brief Generates a Sudoku board with a not necessarily unique solution.
@@ -104,7 +314,8 @@ namespace Sudoku{
          * 
          * @param board The Board to be filled.
          */
-		void generate(Board& baord);
+		template<int BlockSize>
+		void generate(BasicBoard<BlockSize>& baord);
 
         /**
          * @brief Generates a Sudoku board with a unique solution.
@@ -112,22 +323,68 @@ namespace Sudoku{
          * Generates a Sudoku board with a given difficulty level.
          * The generated board is stored in the given Board object.
          * The generated board has a unique solution.
+         * With a target grade the longest prefix of the removals that does not exceed the grade is kept.
          * 
          * @param board The Board to be filled.
          */
 		void generateUnique(Board& board);
 
         /**
-         * @brief Determins if the number of solutions of the given MarkedBoard is 0, 1 or more than 1.
+         * @brief Generates a board of another size with a unique solution, cleared according to the difficulty.
+         * 
+         * @param board The Board to be filled.
+         */
+		template<int BlockSize>
+		void generateUnique(BasicBoard<BlockSize>& board);
+
+        /**
+         * @brief Clears random cells of a filled board one by one and keeps the ones after which the solution stays unique.
+         * 
+         * Tries as many cells as a HARD board clears at most. Stops early when the budget runs out.
+         * 
+         * @param board The filled board. It is left unchanged.
+         * @param removals Receives the row and column of every verified removal, in the order they were made.
+         */
+		template<int BlockSize>
+		void findRemovals(const BasicBoard<BlockSize>& board, std::vector<std::pair<int, int>>& removals);
+
+        /**
+         * @brief Returns how many of the verified removals a unique board of the difficulty keeps.
+         * 
+         * @param removal_cnt The number of verified removals.
+         * @param cell_count The number of cells of the board.
+         * @return The length of the prefix of the removals to keep.
+         */
+		size_t keptRemovals(size_t removal_cnt, int cell_count) const;
+
+        /**
+         * @brief Checks if the board has a solution with a value other than \p k in the given cell.
+         * 
+         * Called after \p k was cleared from a cell of a board that still contains a known solution,
+         * so the board stays uniquely solvable exactly if no solution uses another value in that cell.
+         * Every other candidate of the cell is tried in turn and the first solvable one ends the search,
+         * which is much cheaper than counting the solutions of the whole board.
+         * 
+         * @param board The board with the cleared cell. It is left unchanged.
+         * @param rowIdx The row index of the cleared cell.
+         * @param colIdx The column index of the cleared cell.
+         * @param k The index of the cleared value in Constants::ALPHABET.
+         * @return true if a solution with another value in the cell exists, false otherwise.
+         */
+		bool hasAlternativeSolution(MarkedBoard& board, int rowIdx, int colIdx, int k);
+
+        /**
+         * @brief Checks a board of another size for an alternative solution like the 9x9 overload, with the BasicBitboardSolver.
          * 
-         * Counts the number of solutions of the given MarkedBoard starting from the given cell.
-         * Returns the number of solutions if it is 0 or 1, or 2 if it is more than 1.
+         * Every check gets CHECK_NODE_LIMIT nodes and reports an alternative when they run out, so the board stays unique.
          * 
-         * @param board The MarkedBoard to be counted.
-         * @param rowIdx The row index of the cell to be counted.
-         * @param colIdx The column index of the cell to be counted.
-         * @return 0 if the board has no solution, 1 if it has a unique solution, 2 if it has more than 1 solution.
+         * @param board The board with the cleared cell. It is left unchanged.
+         * @param rowIdx The row index of the cleared cell.
+         * @param colIdx The column index of the cleared cell.
+         * @param k The index of the cleared value in the alphabet of the size.
+         * @return true if a solution with another value in the cell exists, false otherwise.
          */
-		int solutionCount(MarkedBoard& board, int rowIdx, int colIdx);
+		template<int BlockSize>
+		bool hasAlternativeSolution(BasicMarkedBoard<BlockSize>& board, int rowIdx, int colIdx, int k);
 	};
 }
\ No newline at end of file
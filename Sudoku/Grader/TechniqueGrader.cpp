@@ -0,0 +1,327 @@
+/**
+* @file TechniqueGrader.cpp
+* @brief Implements the TechniqueGrader.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <array>
+#include "TechniqueGrader.hpp"
+#include "../Sudoku/Board.hpp"
+#include "../Constants.hpp"
+#include "../Bits.hpp"
+
+using Constants::BOARD_SIZE;
+using Constants::BLOCK_SIZE;
+
+namespace Sudoku{
+	// score of a single application of each technique
+	static const int TECHNIQUE_WEIGHT[TECHNIQUE_COUNT] = {1, 2, 4, 4, 6, 8, 12};
+
+	const TechniqueGrader::Tables TechniqueGrader::TABLES = TechniqueGrader::buildTables();
+
+	TechniqueGrader::Tables TechniqueGrader::buildTables(){
+		Tables tables;
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int t=0; t<BOARD_SIZE; t++){
+				tables.units[i][t] = static_cast<uint8_t>(i*BOARD_SIZE + t);
+				tables.units[BOARD_SIZE + i][t] = static_cast<uint8_t>(t*BOARD_SIZE + i);
+				int ri = (i/BLOCK_SIZE)*BLOCK_SIZE + t/BLOCK_SIZE;
+				int ci = (i%BLOCK_SIZE)*BLOCK_SIZE + t%BLOCK_SIZE;
+				tables.units[2*BOARD_SIZE + i][t] = static_cast<uint8_t>(ri*BOARD_SIZE + ci);
+			}
+		}
+		for(int cell=0; cell<CELL_COUNT; cell++){
+			int ri = cell / BOARD_SIZE, ci = cell % BOARD_SIZE;
+			tables.cell_units[cell][0] = static_cast<uint8_t>(ri);
+			tables.cell_units[cell][1] = static_cast<uint8_t>(BOARD_SIZE + ci);
+			tables.cell_units[cell][2] = static_cast<uint8_t>(2*BOARD_SIZE + Board::getBlockNum(ri, ci));
+			int peer_cnt = 0;
+			for(int other=0; other<CELL_COUNT; other++){
+				int ro = other / BOARD_SIZE, co = other % BOARD_SIZE;
+				if(other != cell && (ro == ri || co == ci || Board::getBlockNum(ro, co) == Board::getBlockNum(ri, ci)))
+					tables.peers[cell][peer_cnt++] = static_cast<uint8_t>(other);
+			}
+		}
+		return tables;
+	}
+
+	Grade TechniqueGrader::gradeOf(Technique technique){
+		switch(technique)
+		{
+		case NAKED_SINGLE:
+		case HIDDEN_SINGLE:
+			return SIMPLE;
+		case POINTING:
+		case BOX_LINE:
+			return MODERATE;
+		case NAKED_PAIR:
+		case HIDDEN_PAIR:
+			return ADVANCED;
+		default:
+			return EXPERT;
+		}
+	}
+
+	GradeReport TechniqueGrader::grade(const Board& board) const {
+		Board result;
+		return this->grade(board, result);
+	}
+
+	GradeReport TechniqueGrader::grade(const Board& board, Board& result) const {
+		typedef bool (*TechniqueFn)(State&, int&);
+		static const TechniqueFn TECHNIQUES[TECHNIQUE_COUNT] = {
+			&TechniqueGrader::nakedSingles, &TechniqueGrader::hiddenSingles,
+			&TechniqueGrader::pointing, &TechniqueGrader::boxLine,
+			&TechniqueGrader::nakedPairs, &TechniqueGrader::hiddenPairs,
+			&TechniqueGrader::xWings
+		};
+
+		State state;
+		state.empty_cnt = CELL_COUNT;
+		state.contradiction = false;
+		for(int cell=0; cell<CELL_COUNT; cell++){
+			state.candidates[cell] = FULL_MASK;
+			state.values[cell] = -1;
+		}
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(board[i][j] == Constants::EMPTY_CELL)
+					continue;
+				int k = Constants::keyIndex(board[i][j]);
+				if(k < 0)
+					state.contradiction = true;
+				else
+					place(state, i*BOARD_SIZE + j, k);
+			}
+		}
+
+		GradeReport report;
+		while(state.empty_cnt > 0 && !state.contradiction){
+			bool progress = false;
+			for(int t=0; t<TECHNIQUE_COUNT && !progress; t++){
+				int steps = 0;
+				progress = TECHNIQUES[t](state, steps);
+				if(steps > 0){
+					report.technique_counts[t] += steps;
+					report.score += steps * TECHNIQUE_WEIGHT[t];
+					if(gradeOf(static_cast<Technique>(t)) > report.grade)
+						report.grade = gradeOf(static_cast<Technique>(t));
+				}
+			}
+			if(!progress)
+				break;
+		}
+		report.solved = state.empty_cnt == 0 && !state.contradiction;
+		if(!report.solved)
+			report.grade = BEYOND_TECHNIQUES;
+
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				int k = state.values[i*BOARD_SIZE + j];
+				result[i][j] = k < 0 ? Constants::EMPTY_CELL : Constants::ALPHABET[k];
+			}
+		}
+		return report;
+	}
+
+	void TechniqueGrader::place(State& state, int cell, int k){
+		Mask bit = static_cast<Mask>(1u << k);
+		if(state.values[cell] >= 0 || !(state.candidates[cell] & bit)){
+			state.contradiction = true; // the value was taken by a peer already
+			return;
+		}
+		state.values[cell] = static_cast<int8_t>(k);
+		state.candidates[cell] = 0;
+		state.empty_cnt--;
+		for(int p=0; p<PEER_COUNT; p++){
+			int peer = TABLES.peers[cell][p];
+			if(state.values[peer] < 0 && (state.candidates[peer] &= static_cast<Mask>(~bit)) == 0)
+				state.contradiction = true;
+		}
+	}
+
+	bool TechniqueGrader::eliminate(State& state, int cell, Mask mask){
+		if(state.values[cell] >= 0 || !(state.candidates[cell] & mask))
+			return false;
+		if((state.candidates[cell] &= static_cast<Mask>(~mask)) == 0)
+			state.contradiction = true;
+		return true;
+	}
+
+	TechniqueGrader::Mask TechniqueGrader::positions(const State& state, int unit, int k){
+		Mask pos = 0;
+		for(int t=0; t<BOARD_SIZE; t++){
+			if(state.candidates[TABLES.units[unit][t]] >> k & 1u)
+				pos |= static_cast<Mask>(1u << t);
+		}
+		return pos;
+	}
+
+	bool TechniqueGrader::nakedSingles(State& state, int& steps){
+		for(int cell=0; cell<CELL_COUNT && !state.contradiction; cell++){
+			Mask candidates = state.candidates[cell];
+			if(state.values[cell] < 0 && candidates && !(candidates & (candidates - 1))){
+				place(state, cell, Bits::ctz(candidates));
+				steps++;
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::hiddenSingles(State& state, int& steps){
+		for(int u=0; u<UNIT_COUNT && !state.contradiction; u++){
+			Mask once = 0, twice = 0;
+			for(int t=0; t<BOARD_SIZE; t++){
+				Mask candidates = state.candidates[TABLES.units[u][t]];
+				twice |= once & candidates;
+				once |= candidates;
+			}
+			Mask hidden = once & static_cast<Mask>(~twice);
+			while(hidden && !state.contradiction){
+				int k = Bits::ctz(hidden);
+				hidden &= hidden - 1;
+				for(int t=0; t<BOARD_SIZE; t++){
+					int cell = TABLES.units[u][t];
+					if(state.candidates[cell] >> k & 1u){
+						place(state, cell, k);
+						steps++;
+						break;
+					}
+				}
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::pointing(State& state, int& steps){
+		for(int b=0; b<BOARD_SIZE; b++){
+			int block = 2*BOARD_SIZE + b;
+			for(int k=0; k<BOARD_SIZE; k++){
+				Mask pos = positions(state, block, k);
+				if(!pos)
+					continue;
+				// block cells are stored row by row, so rows and columns of the block follow from the positions
+				int first = Bits::ctz(pos);
+				bool same_row = true, same_col = true;
+				for(Mask rest = pos; rest; rest &= rest - 1){
+					int t = Bits::ctz(rest);
+					same_row &= t / BLOCK_SIZE == first / BLOCK_SIZE;
+					same_col &= t % BLOCK_SIZE == first % BLOCK_SIZE;
+				}
+				if(!same_row && !same_col)
+					continue;
+				int cell = TABLES.units[block][first];
+				int line = same_row ? TABLES.cell_units[cell][0] : TABLES.cell_units[cell][1];
+				bool eliminated = false;
+				for(int t=0; t<BOARD_SIZE; t++){
+					int other = TABLES.units[line][t];
+					if(TABLES.cell_units[other][2] != block)
+						eliminated |= eliminate(state, other, static_cast<Mask>(1u << k));
+				}
+				steps += eliminated;
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::boxLine(State& state, int& steps){
+		for(int line=0; line<2*BOARD_SIZE; line++){
+			for(int k=0; k<BOARD_SIZE; k++){
+				Mask pos = positions(state, line, k);
+				if(!pos)
+					continue;
+				int block = TABLES.cell_units[TABLES.units[line][Bits::ctz(pos)]][2];
+				bool same_block = true;
+				for(Mask rest = pos; rest; rest &= rest - 1)
+					same_block &= TABLES.cell_units[TABLES.units[line][Bits::ctz(rest)]][2] == block;
+				if(!same_block)
+					continue;
+				bool eliminated = false;
+				for(int t=0; t<BOARD_SIZE; t++){
+					int other = TABLES.units[block][t];
+					if(TABLES.cell_units[other][line < BOARD_SIZE ? 0 : 1] != line)
+						eliminated |= eliminate(state, other, static_cast<Mask>(1u << k));
+				}
+				steps += eliminated;
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::nakedPairs(State& state, int& steps){
+		for(int u=0; u<UNIT_COUNT; u++){
+			for(int t1=0; t1<BOARD_SIZE; t1++){
+				Mask pair = state.candidates[TABLES.units[u][t1]];
+				if(Bits::popcount(pair) != 2)
+					continue;
+				for(int t2=t1+1; t2<BOARD_SIZE; t2++){
+					if(state.candidates[TABLES.units[u][t2]] != pair)
+						continue;
+					bool eliminated = false;
+					for(int t=0; t<BOARD_SIZE; t++){
+						if(t != t1 && t != t2)
+							eliminated |= eliminate(state, TABLES.units[u][t], pair);
+					}
+					steps += eliminated;
+					break;
+				}
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::hiddenPairs(State& state, int& steps){
+		for(int u=0; u<UNIT_COUNT; u++){
+			Mask pos[BOARD_SIZE];
+			for(int k=0; k<BOARD_SIZE; k++)
+				pos[k] = positions(state, u, k);
+			for(int k1=0; k1<BOARD_SIZE; k1++){
+				if(Bits::popcount(pos[k1]) != 2)
+					continue;
+				for(int k2=k1+1; k2<BOARD_SIZE; k2++){
+					if(pos[k2] != pos[k1])
+						continue;
+					Mask others = static_cast<Mask>(FULL_MASK & ~((1u << k1) | (1u << k2)));
+					bool eliminated = false;
+					for(Mask rest = pos[k1]; rest; rest &= rest - 1)
+						eliminated |= eliminate(state, TABLES.units[u][Bits::ctz(rest)], others);
+					steps += eliminated;
+					break;
+				}
+			}
+		}
+		return steps > 0;
+	}
+
+	bool TechniqueGrader::xWings(State& state, int& steps){
+		// base lines are rows with the columns as cover lines, then the other way around
+		for(int base=0; base<2*BOARD_SIZE; base+=BOARD_SIZE){
+			int cover = BOARD_SIZE - base;
+			for(int k=0; k<BOARD_SIZE; k++){
+				Mask pos[BOARD_SIZE];
+				for(int l=0; l<BOARD_SIZE; l++)
+					pos[l] = positions(state, base + l, k);
+				for(int l1=0; l1<BOARD_SIZE; l1++){
+					if(Bits::popcount(pos[l1]) != 2)
+						continue;
+					for(int l2=l1+1; l2<BOARD_SIZE; l2++){
+						if(pos[l2] != pos[l1])
+							continue;
+						// position t of a row is column t and the other way around, so the positions name the cover lines
+						bool eliminated = false;
+						for(Mask rest = pos[l1]; rest; rest &= rest - 1){
+							int line = cover + Bits::ctz(rest);
+							for(int t=0; t<BOARD_SIZE; t++){
+								if(t != l1 && t != l2)
+									eliminated |= eliminate(state, TABLES.units[line][t], static_cast<Mask>(1u << k));
+							}
+						}
+						steps += eliminated;
+					}
+				}
+			}
+		}
+		return steps > 0;
+	}
+}
@@ -0,0 +1,153 @@
+/**
+* @file TechniqueGrader.hpp
+* @brief Defines the TechniqueGrader class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "../Sudoku/Board.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Human solving techniques applied by the TechniqueGrader, from the simplest to the hardest.
+     */
+    enum Technique{
+        NAKED_SINGLE, /**< A cell with a single candidate. */
+        HIDDEN_SINGLE, /**< A value with a single place left in a row, column or block. */
+        POINTING, /**< The candidates of a value in a block lie on one row or column, so the rest of the line loses it. */
+        BOX_LINE, /**< The candidates of a value in a row or column lie in one block, so the rest of the block loses it. */
+        NAKED_PAIR, /**< Two cells of a unit with the same two candidates, which the rest of the unit loses. */
+        HIDDEN_PAIR, /**< Two values of a unit that only fit the same two cells, which lose every other candidate. */
+        X_WING, /**< The candidates of a value in two rows (columns) lie on the same two columns (rows), which lose it elsewhere. */
+        TECHNIQUE_COUNT /**< Number of techniques. */
+    };
+
+    /**
+     * @brief Difficulty grades, given by the hardest technique a board needs.
+     */
+    enum Grade{
+        SIMPLE, /**< Naked and hidden singles only. */
+        MODERATE, /**< Also needs pointing or box-line reduction. */
+        ADVANCED, /**< Also needs naked or hidden pairs. */
+        EXPERT, /**< Also needs X-wings. */
+        BEYOND_TECHNIQUES /**< Cannot be solved with the techniques of the grader, or has no solution at all. */
+    };
+
+    /**
+     * @brief Outcome of grading a board.
+     */
+    struct GradeReport {
+        Grade grade = SIMPLE; /**< The grade of the board. */
+        int score = 0; /**< Sum of the weights of every technique application, ranks boards of the same grade. */
+        int technique_counts[TECHNIQUE_COUNT] = {}; /**< How many times each technique made progress. */
+        bool solved = false; /**< Whether the techniques solved the board. */
+    };
+
+    /**
+     * @brief Grades boards by solving them the way a person would.
+     *
+     * @details The grader keeps a candidate mask per cell and repeatedly applies the simplest technique that makes
+     * progress, starting over from the simplest one after every step, until the board is solved or no technique applies.
+     * The grade is given by the hardest technique that was needed. The whole state lives in fixed size arrays on the stack,
+     * so grading allocates nothing and one grader can be used from several threads.
+     */
+    class TechniqueGrader {
+        static_assert(BOARD_SIZE <= 16, "TechniqueGrader masks hold at most 16 values.");
+
+    public:
+        /**
+         * @brief Grades the given board.
+         * @param board The board to grade. Its givens are assumed not to break the rules.
+         * @return The grade, score and technique counts of the board.
+         */
+        GradeReport grade(const Board& board) const;
+
+        /**
+         * @brief Grades the given board and writes the cells the techniques filled.
+         * @param board The board to grade. Its givens are assumed not to break the rules.
+         * @param result The board with every cell filled by the techniques. Solved if the report says so.
+         * @return The grade, score and technique counts of the board.
+         */
+        GradeReport grade(const Board& board, Board& result) const;
+
+        /**
+         * @brief Gets the grade that corresponds to a technique.
+         * @param technique The technique.
+         * @return The lowest grade that allows the technique.
+         */
+        static Grade gradeOf(Technique technique);
+
+    private:
+        typedef uint16_t Mask; /**< Candidate mask of a cell, or position mask of a value in a unit. */
+
+        static const int CELL_COUNT = BOARD_SIZE * BOARD_SIZE; /**< Number of cells on the board. */
+        static const int UNIT_COUNT = 3 * BOARD_SIZE; /**< Rows, then columns, then blocks. */
+        static const int PEER_COUNT = 3 * BOARD_SIZE - 2 * Constants::BLOCK_SIZE - 1; /**< Cells that share a unit with a cell. */
+        static const Mask FULL_MASK = static_cast<Mask>((1u << BOARD_SIZE) - 1); /**< Every value of the alphabet. */
+
+        /**
+         * @brief Cell indices of every unit and peers of every cell, so the techniques never divide.
+         */
+        struct Tables {
+            uint8_t units[UNIT_COUNT][BOARD_SIZE]; /**< Cells of every unit. */
+            uint8_t peers[CELL_COUNT][PEER_COUNT]; /**< Peers of every cell. */
+            uint8_t cell_units[CELL_COUNT][3]; /**< Row, column and block unit of every cell. */
+        };
+
+        static const Tables TABLES; /**< Unit and peer tables. */
+
+        /**
+         * @brief Builds the TABLES.
+         * @return The unit and peer tables.
+         */
+        static Tables buildTables();
+
+        /**
+         * @brief Grading state.
+         */
+        struct State {
+            Mask candidates[CELL_COUNT]; /**< Candidates of every empty cell, 0 for filled cells. */
+            int8_t values[CELL_COUNT]; /**< Alphabet index of every filled cell, -1 for empty cells. */
+            int empty_cnt; /**< Number of empty cells. */
+            bool contradiction; /**< Set when an empty cell loses its last candidate. */
+        };
+
+        /**
+         * @brief Fills a cell and removes the value from the candidates of its peers.
+         * @param state The grading state.
+         * @param cell The cell to fill.
+         * @param k The alphabet index of the value.
+         */
+        static void place(State& state, int cell, int k);
+
+        /**
+         * @brief Removes candidates from a cell.
+         * @param state The grading state.
+         * @param cell The cell.
+         * @param mask The candidates to remove.
+         * @return true if the cell had any of them, false otherwise.
+         */
+        static bool eliminate(State& state, int cell, Mask mask);
+
+        /**
+         * @brief Position mask of a value in a unit: bit t is set if the t-th cell of the unit can take it.
+         * @param state The grading state.
+         * @param unit The unit.
+         * @param k The alphabet index of the value.
+         * @return The position mask.
+         */
+        static Mask positions(const State& state, int unit, int k);
+
+        static bool nakedSingles(State& state, int& steps); /**< Applies every naked single. */
+        static bool hiddenSingles(State& state, int& steps); /**< Applies every hidden single. */
+        static bool pointing(State& state, int& steps); /**< Applies every pointing reduction. */
+        static bool boxLine(State& state, int& steps); /**< Applies every box-line reduction. */
+        static bool nakedPairs(State& state, int& steps); /**< Applies every naked pair. */
+        static bool hiddenPairs(State& state, int& steps); /**< Applies every hidden pair. */
+        static bool xWings(State& state, int& steps); /**< Applies every X-wing. */
+    };
+}
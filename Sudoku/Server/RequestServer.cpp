@@ -0,0 +1,618 @@
+/**
+* @file RequestServer.cpp
+* @brief Implements the RequestServer.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "RequestServer.hpp"
+#include "../FileIO/FileIO.hpp"
+#include "../Generator/SudokuGenerator.hpp"
+#include "../Grader/TechniqueGrader.hpp"
+#include "../Constants.hpp"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using Constants::BOARD_SIZE;
+
+namespace Server{
+	RequestServer::RequestServer(Sudoku::SolverEngine engine, int thread_count)
+		: engine(thread_count), producers(0), stopping(false)
+	{
+		this->engine.setSolverEngine(engine);
+		this->engine.setNodeLimit(DEFAULT_NODE_LIMIT);
+	}
+
+	int RequestServer::getThreadCount() const {
+		return this->engine.getThreadCount();
+	}
+
+	void RequestServer::setCacheCapacity(size_t capacity){
+		this->engine.setCacheCapacity(capacity);
+	}
+
+	void RequestServer::setNodeLimit(uint64_t node_limit){
+		this->engine.setNodeLimit(node_limit);
+	}
+
+	void RequestServer::reset(int producers){
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->queue.clear();
+		this->producers = producers;
+		this->stopping = false;
+		this->stats = ServerStats();
+	}
+
+	bool RequestServer::push(Request request){
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			if(this->stopping)
+				return false;
+			this->queue.push_back(std::move(request));
+		}
+		this->ready.notify_one();
+		return true;
+	}
+
+	bool RequestServer::addProducer(){
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if(this->stopping)
+			return false;
+		this->producers++;
+		this->stats.connections++;
+		return true;
+	}
+
+	void RequestServer::finishProducer(){
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->producers--;
+		}
+		this->ready.notify_one();
+	}
+
+	void RequestServer::processLoop(){
+		std::vector<Request> batch;
+		while(true){
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->ready.wait(lock, [this]{ return !this->queue.empty() || this->producers == 0 || this->stopping; });
+				// requests queued after a shutdown are dropped
+				if(this->stopping || this->queue.empty())
+					return;
+				// everything that queued up while the last batch was processed forms the next one
+				size_t batch_size = std::min(this->queue.size(), static_cast<size_t>(MAX_BATCH));
+				for(size_t i=0; i<batch_size; i++){
+					batch.push_back(std::move(this->queue.front()));
+					this->queue.pop_front();
+				}
+			}
+			this->processBatch(batch);
+			batch.clear();
+		}
+	}
+
+	void RequestServer::processBatch(std::vector<Request>& batch){
+		this->stats.batches++;
+		this->stats.requests += batch.size();
+		this->stats.max_batch = std::max(this->stats.max_batch, static_cast<long long>(batch.size()));
+
+		std::vector<Task> tasks(batch.size());
+		for(size_t i=0; i<batch.size(); i++)
+			this->parse(batch[i], tasks[i]);
+
+		// every solve of the batch runs in one call across the threads of the engine
+		std::vector<Sudoku::Board> boards;
+		std::vector<size_t> indices;
+		for(size_t i=0; i<tasks.size(); i++){
+			if(tasks[i].kind == Task::SOLVE){
+				boards.push_back(tasks[i].board);
+				indices.push_back(i);
+			}
+		}
+		if(!boards.empty()){
+			std::vector<Sudoku::SolveStatus> statuses(boards.size());
+			this->engine.solve(boards.data(), boards.size(), boards.data(), statuses.data(), &this->stats.solver);
+			for(size_t k=0; k<indices.size(); k++){
+				Task& task = tasks[indices[k]];
+				if(statuses[k] == Sudoku::SOLVE_SOLVED)
+					task.reply = "solved " + formatBoard(boards[k]);
+				else if(statuses[k] == Sudoku::SOLVE_BUDGET)
+					task.reply = "error budget";
+				else
+					task.reply = statuses[k] == Sudoku::SOLVE_UNSOLVABLE ? "unsolvable" : "invalid";
+			}
+		}
+
+		// generate requests share the difficulty and uniqueness of the engine, so they run in one call per combination
+		const Sudoku::Difficulty difficulties[] = {Sudoku::EASY, Sudoku::MEDIUM, Sudoku::HARD};
+		for(Sudoku::Difficulty difficulty : difficulties){
+			for(int unique=0; unique<2; unique++){
+				std::vector<uint64_t> seeds;
+				indices.clear();
+				for(size_t i=0; i<tasks.size(); i++){
+					if(tasks[i].kind == Task::GENERATE && tasks[i].difficulty == difficulty && tasks[i].unique == bool(unique)){
+						seeds.push_back(tasks[i].seed);
+						indices.push_back(i);
+					}
+				}
+				if(seeds.empty())
+					continue;
+				boards.resize(seeds.size());
+				this->engine.setDifficulty(difficulty);
+				this->engine.setUnique(unique != 0);
+				this->engine.generate(boards.data(), seeds.data(), seeds.size());
+				for(size_t k=0; k<indices.size(); k++)
+					tasks[indices[k]].reply = "board " + formatBoard(boards[k]);
+			}
+		}
+
+		// one write per client and batch, the replies of a client keep the order of its requests
+		std::vector<std::pair<Connection*, std::string>> outputs;
+		bool shutdown = false;
+		for(size_t i=0; i<tasks.size(); i++){
+			if(tasks[i].reply.compare(0, 6, "error ") == 0)
+				this->stats.errors++;
+			shutdown = shutdown || tasks[i].kind == Task::SHUTDOWN;
+			Connection* connection = batch[i].connection.get();
+			auto output = std::find_if(outputs.begin(), outputs.end(), [&](const std::pair<Connection*, std::string>& o){
+				return o.first == connection;
+			});
+			if(output == outputs.end()){
+				outputs.emplace_back(connection, std::string());
+				output = outputs.end() - 1;
+			}
+			output->second += tasks[i].id;
+			output->second += ' ';
+			output->second += tasks[i].reply;
+			output->second += '\n';
+		}
+		for(std::pair<Connection*, std::string>& output : outputs)
+			output.first->write(output.second);
+
+		if(shutdown){
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stopping = true;
+			}
+			if(this->on_shutdown)
+				this->on_shutdown();
+		}
+	}
+
+	void RequestServer::parse(const Request& request, Task& task){
+		static const char* const GRADE_NAMES[] = {"simple", "moderate", "advanced", "expert", "beyond"};
+
+		std::vector<std::string> tokens = split(request.line);
+		task.id = tokens.empty() ? "-" : tokens[0];
+		if(request.too_long){
+			task.reply = "error line too long";
+			return;
+		}
+		if(tokens.size() < 2){
+			task.reply = "error missing command";
+			return;
+		}
+		const std::string& command = tokens[1];
+		size_t arg_cnt = tokens.size() - 2;
+		Sudoku::Board start_board;
+		uint64_t value = 0;
+
+		if(command == "solve"){
+			if(arg_cnt != 1 || !parseBoard(tokens[2], task.board)){
+				task.reply = "error solve needs one board";
+				return;
+			}
+			task.kind = Task::SOLVE;
+		} else if(command == "count"){
+			if(arg_cnt < 1 || arg_cnt > 2 || !parseBoard(tokens[2], task.board)){
+				task.reply = "error count needs a board and an optional limit";
+				return;
+			}
+			if(arg_cnt == 2 && (!parseUnsigned(tokens[3], value) || value < 1 || value > MAX_COUNT_LIMIT)){
+				task.reply = "error the limit of count must be between 1 and " + std::to_string(MAX_COUNT_LIMIT);
+				return;
+			}
+			int limit = arg_cnt == 2 ? static_cast<int>(value) : 2;
+			int count = this->engine.countSolutions(task.board, limit);
+			task.reply = count < 0 ? "error budget" : "count " + std::to_string(count);
+		} else if(command == "valid"){
+			if(arg_cnt != 1 || !parseBoard(tokens[2], task.board)){
+				task.reply = "error valid needs one board";
+				return;
+			}
+			task.reply = this->engine.isValid(task.board) ? "valid" : "invalid";
+		} else if(command == "check"){
+			if(arg_cnt != 2 || !parseBoard(tokens[2], start_board) || !parseBoard(tokens[3], task.board)){
+				task.reply = "error check needs the start board and the solution";
+				return;
+			}
+			Sudoku::SolutionReport report;
+			if(this->engine.isSolved(task.board, start_board, report)){
+				task.reply = "solved";
+			} else {
+				task.reply = "unsolved " + std::to_string(report.correct_values) + ' ' +
+					std::to_string(report.incorrect_values) + ' ' + std::to_string(report.empty_cells);
+			}
+		} else if(command == "generate"){
+			if(arg_cnt < 1 || arg_cnt > 3 || tokens[2].size() != 1 || std::string("emh").find(tokens[2][0]) == std::string::npos){
+				task.reply = "error generate needs a difficulty: e, m or h";
+				return;
+			}
+			task.difficulty = tokens[2][0] == 'e' ? Sudoku::EASY : tokens[2][0] == 'm' ? Sudoku::MEDIUM : Sudoku::HARD;
+			bool seeded = false;
+			for(size_t t=3; t<tokens.size(); t++){
+				if(tokens[t] == "unique" && !task.unique){
+					task.unique = true;
+				} else if(!seeded && parseUnsigned(tokens[t], task.seed)){
+					seeded = true;
+				} else {
+					task.reply = "error invalid generate option '" + tokens[t] + "'";
+					return;
+				}
+			}
+			if(!seeded)
+				task.seed = Sudoku::SudokuGenerator::randomSeed();
+			task.kind = Task::GENERATE;
+		} else if(command == "grade"){
+			if(arg_cnt != 1 || !parseBoard(tokens[2], task.board)){
+				task.reply = "error grade needs one board";
+				return;
+			}
+			Sudoku::GradeReport report = this->engine.grade(task.board);
+			task.reply = std::string("grade ") + GRADE_NAMES[report.grade] + ' ' + std::to_string(report.score);
+		} else if(command == "ping"){
+			task.reply = "pong";
+		} else if(command == "shutdown"){
+			task.reply = "bye";
+			task.kind = Task::SHUTDOWN;
+		} else {
+			task.reply = "error unknown command '" + command + "'";
+		}
+	}
+
+	std::vector<std::string> RequestServer::split(const std::string& line){
+		std::vector<std::string> tokens;
+		size_t i = 0;
+		while(i < line.size()){
+			while(i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+				i++;
+			size_t begin = i;
+			while(i < line.size() && line[i] != ' ' && line[i] != '\t')
+				i++;
+			if(i > begin)
+				tokens.emplace_back(line, begin, i - begin);
+		}
+		return tokens;
+	}
+
+	bool RequestServer::parseUnsigned(const std::string& token, uint64_t& value){
+		if(token.empty() || token.size() > 20)
+			return false;
+		uint64_t result = 0;
+		for(char ch : token){
+			if(ch < '0' || ch > '9')
+				return false;
+			uint64_t digit = static_cast<uint64_t>(ch - '0');
+			if(result > (UINT64_MAX - digit) / 10)
+				return false;
+			result = result*10 + digit;
+		}
+		value = result;
+		return true;
+	}
+
+	bool RequestServer::parseBoard(const std::string& token, Sudoku::Board& board){
+		try{
+			FileIO::parseLine(token, board);
+		}
+		catch(const std::invalid_argument&){
+			return false;
+		}
+		return true;
+	}
+
+	std::string RequestServer::formatBoard(const Sudoku::Board& board){
+		std::string line(BOARD_SIZE*BOARD_SIZE, '.');
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(board[i][j] != Constants::EMPTY_CELL)
+					line[i*BOARD_SIZE + j] = board[i][j];
+			}
+		}
+		return line;
+	}
+
+	ServerStats RequestServer::serve(std::istream& in, std::ostream& out){
+		this->reset(1);
+		this->stats.connections = 1;
+		this->on_shutdown = nullptr;
+		std::shared_ptr<Connection> connection(new Connection());
+		connection->write = [&out](const std::string& replies){
+			out << replies;
+			out.flush();
+		};
+
+		std::thread processor(&RequestServer::processLoop, this);
+		std::string line;
+		while(std::getline(in, line)){
+			if(!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if(line.find_first_not_of(" \t") == std::string::npos)
+				continue;
+			Request request;
+			request.connection = connection;
+			request.too_long = line.size() > MAX_LINE;
+			if(request.too_long)
+				line.resize(MAX_LINE);
+			request.line = std::move(line);
+			if(!this->push(std::move(request)))
+				break;
+		}
+		this->finishProducer();
+		processor.join();
+		return this->stats;
+	}
+
+#ifdef _WIN32
+	ServerStats RequestServer::serveSocket(const std::string& path){
+		throw std::runtime_error("Unix domain sockets are not supported on Windows, serve the standard input instead.");
+	}
+#else
+	void RequestServer::sendOutbox(SocketClient& client){
+#ifdef MSG_NOSIGNAL
+		const int flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+#else
+		const int flags = MSG_DONTWAIT;
+#endif
+		size_t written = 0;
+		bool failed = false;
+		while(written < client.outbox.size()){
+			ssize_t n = ::send(client.fd, client.outbox.data() + written, client.outbox.size() - written, flags);
+			if(n < 0 && errno == EINTR)
+				continue;
+			if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+				break;
+			if(n <= 0){
+				failed = true;
+				break;
+			}
+			written += static_cast<size_t>(n);
+		}
+		client.outbox.erase(0, written);
+		if(failed || client.outbox.size() > MAX_OUTBOX){
+			// the client is gone or does not read its replies, its reader stops and its later replies are discarded
+			client.dropped = true;
+			client.outbox.clear();
+			::shutdown(client.fd, SHUT_RDWR);
+		}
+	}
+
+	ServerStats RequestServer::serveSocket(const std::string& path){
+		sockaddr_un address;
+		std::memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+		if(path.empty() || path.size() >= sizeof(address.sun_path))
+			throw std::runtime_error("Invalid socket path '" + path + "'.");
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+		// the processing thread wakes the listener through the pipe when replies wait for a socket
+		int wake_fds[2];
+		if(::pipe(wake_fds) < 0)
+			throw std::runtime_error(std::string("Cannot create a pipe: ") + std::strerror(errno));
+		::fcntl(wake_fds[0], F_SETFL, O_NONBLOCK);
+		::fcntl(wake_fds[1], F_SETFL, O_NONBLOCK);
+		int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		if(listen_fd < 0){
+			std::string error = std::strerror(errno);
+			::close(wake_fds[0]);
+			::close(wake_fds[1]);
+			throw std::runtime_error("Cannot create a socket: " + error);
+		}
+		::unlink(path.c_str());
+		if(::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(listen_fd, 64) < 0){
+			std::string error = std::strerror(errno);
+			::close(listen_fd);
+			::close(wake_fds[0]);
+			::close(wake_fds[1]);
+			throw std::runtime_error("Cannot listen on '" + path + "': " + error);
+		}
+
+		// the listener counts as a reader, so the processing thread waits for clients
+		this->reset(1);
+		std::mutex clients_mutex;
+		std::list<std::shared_ptr<SocketClient>> clients;
+		auto wake = [&]{
+			char byte = 0;
+			// a full pipe already wakes the listener
+			ssize_t ignored = ::write(wake_fds[1], &byte, 1);
+			(void)ignored;
+		};
+		this->on_shutdown = [&]{
+			// unblocks the readers, the queued replies are still sent
+			std::lock_guard<std::mutex> lock(clients_mutex);
+			for(const std::shared_ptr<SocketClient>& client : clients)
+				::shutdown(client->fd, SHUT_RD);
+		};
+		std::thread processor(&RequestServer::processLoop, this);
+
+		bool stopped = false;
+		auto stop = [&]{
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stopping = true;
+			}
+			// the processing thread returns after its current batch
+			this->finishProducer();
+			processor.join();
+			this->on_shutdown();
+			{
+				// the requests dropped by the shutdown still hold their clients
+				std::deque<Request> dropped;
+				std::lock_guard<std::mutex> lock(this->mutex);
+				dropped.swap(this->queue);
+			}
+			stopped = true;
+		};
+		std::chrono::steady_clock::time_point deadline;
+		std::vector<std::shared_ptr<SocketClient>> finished, polled;
+		std::vector<pollfd> fds;
+		while(true){
+			if(!stopped){
+				bool stopping;
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					stopping = this->stopping;
+				}
+				if(stopping){
+					stop();
+					deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(SHUTDOWN_TIMEOUT_MS);
+				}
+			}
+
+			fds.clear();
+			polled.clear();
+			fds.push_back({wake_fds[0], POLLIN, 0});
+			if(!stopped)
+				fds.push_back({listen_fd, POLLIN, 0});
+			// a client that left and got all of its replies is closed right away, so a long running server keeps no
+			// descriptor or thread of it, the clients with queued replies are polled for room in their sockets
+			{
+				std::lock_guard<std::mutex> lock(clients_mutex);
+				for(auto client = clients.begin(); client != clients.end();){
+					if((*client)->answered && (*client)->outbox.empty()){
+						finished.push_back(std::move(*client));
+						client = clients.erase(client);
+						continue;
+					}
+					if(!(*client)->outbox.empty()){
+						fds.push_back({(*client)->fd, POLLOUT, 0});
+						polled.push_back(*client);
+					}
+					++client;
+				}
+			}
+			for(const std::shared_ptr<SocketClient>& client : finished){
+				client->reader.join();
+				::close(client->fd);
+			}
+			finished.clear();
+			if(stopped && (clients.empty() || std::chrono::steady_clock::now() >= deadline))
+				break;
+
+			int ready_cnt = ::poll(fds.data(), fds.size(), 100);
+			if(ready_cnt < 0 && errno != EINTR && !stopped)
+				stop();
+			if(ready_cnt <= 0)
+				continue;
+			if(fds[0].revents & POLLIN){
+				char buffer[64];
+				while(::read(wake_fds[0], buffer, sizeof(buffer)) > 0){}
+			}
+			size_t first_client = stopped ? 1 : 2;
+			{
+				std::lock_guard<std::mutex> lock(clients_mutex);
+				for(size_t k=0; k<polled.size(); k++){
+					if(fds[first_client + k].revents != 0 && !polled[k]->dropped)
+						sendOutbox(*polled[k]);
+				}
+			}
+			if(stopped || !(fds[1].revents & POLLIN))
+				continue;
+
+			int fd = ::accept(listen_fd, nullptr, nullptr);
+			if(fd < 0){
+				// out of descriptors, the connection stays queued until a client leaves
+				if(errno == EMFILE || errno == ENFILE)
+					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				continue;
+			}
+			if(!this->addProducer()){
+				::close(fd);
+				continue;
+			}
+			std::shared_ptr<SocketClient> client(new SocketClient());
+			client->fd = fd;
+			// the connection lives as long as the reader or a request of the client, the last one marks the client answered
+			std::shared_ptr<Connection> connection(new Connection(), [client, &clients_mutex, &wake](Connection* connection){
+				delete connection;
+				{
+					std::lock_guard<std::mutex> lock(clients_mutex);
+					client->answered = true;
+				}
+				wake();
+			});
+			// the processing thread only queues the replies, a client that does not read them cannot stall the others
+			connection->write = [client, &clients_mutex, &wake](const std::string& replies){
+				std::lock_guard<std::mutex> lock(clients_mutex);
+				if(client->dropped)
+					return;
+				client->outbox += replies;
+				sendOutbox(*client);
+				if(!client->outbox.empty())
+					wake();
+			};
+			{
+				std::lock_guard<std::mutex> lock(clients_mutex);
+				clients.push_back(client);
+			}
+			client->reader = std::thread([this, fd, connection]{
+				char buffer[4096];
+				Request request;
+				while(true){
+					ssize_t n = ::read(fd, buffer, sizeof(buffer));
+					if(n < 0 && errno == EINTR)
+						continue;
+					if(n <= 0)
+						break;
+					for(ssize_t i=0; i<n; i++){
+						if(buffer[i] != '\n'){
+							if(request.line.size() < MAX_LINE)
+								request.line += buffer[i];
+							else
+								request.too_long = true;
+							continue;
+						}
+						if(!request.line.empty() && request.line.back() == '\r')
+							request.line.pop_back();
+						if(request.line.find_first_not_of(" \t") != std::string::npos){
+							request.connection = connection;
+							if(!this->push(std::move(request)))
+								break;
+						}
+						request = Request();
+					}
+				}
+				this->finishProducer();
+			});
+		}
+
+		// clients that did not take their replies in time are cut off
+		for(const std::shared_ptr<SocketClient>& client : clients){
+			::shutdown(client->fd, SHUT_RDWR);
+			client->reader.join();
+			::close(client->fd);
+		}
+		::close(listen_fd);
+		::close(wake_fds[0]);
+		::close(wake_fds[1]);
+		::unlink(path.c_str());
+		this->on_shutdown = nullptr;
+		return this->stats;
+	}
+#endif
+}
@@ -0,0 +1,251 @@
+/**
+* @file RequestServer.hpp
+* @brief Defines the RequestServer class, the line protocol of the server mode.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../Engine/SudokuEngine.hpp"
+#include "../Solver/SolverStats.hpp"
+
+/**
+ * @brief Contains the long-running server mode.
+ */
+namespace Server {
+    /**
+     * @brief Counters of a serve or serveSocket call.
+     */
+    struct ServerStats {
+        long long connections = 0; /**< Number of clients served, 1 for serve. */
+        long long requests = 0; /**< Number of request lines, empty lines excluded. */
+        long long errors = 0; /**< Requests answered with an error. */
+        long long batches = 0; /**< Number of batches the requests were processed in. */
+        long long max_batch = 0; /**< Number of requests of the largest batch. */
+        Sudoku::SolverStats solver; /**< Work of the solver over every solve request. */
+    };
+
+    /**
+     * @brief Answers solve, generate and check requests of a line protocol with one SudokuEngine.
+     *
+     * @details Every request is one line: a client chosen id without spaces, a command and its arguments, separated by
+     * spaces. Every reply is one line starting with the id of its request. Boards are in the line format of the batch mode.
+     *
+     *     <id> solve <board>              -> <id> solved <board> | <id> unsolvable | <id> invalid | <id> error budget
+     *     <id> count <board> [<limit>]    -> <id> count <n> | <id> error budget
+     *     <id> valid <board>              -> <id> valid | <id> invalid
+     *     <id> check <start> <board>      -> <id> solved | <id> unsolved <correct> <incorrect> <empty>
+     *     <id> generate <e|m|h> [unique] [<seed>] -> <id> board <board>
+     *     <id> grade <board>              -> <id> grade <simple|moderate|advanced|expert|beyond> <score>
+     *     <id> ping                       -> <id> pong
+     *     <id> shutdown                   -> <id> bye, then the server stops
+     *     anything else                   -> <id> error <message>
+     *
+     * The lines are read by one thread per client and queued, and a single processing thread takes everything that is
+     * queued at once as a batch: the solve and generate requests of a batch run together on the threads of the engine,
+     * the cheap requests inline. The replies of a batch are written in the order of its requests, so a client that
+     * pipelines requests matches the replies by their id. The engine, its solvers and its tables are set up once and
+     * stay warm for the whole life of the server.
+     *
+     * Every solve and count searches at most the node limit, DEFAULT_NODE_LIMIT unless setNodeLimit says otherwise, so a
+     * pathological puzzle holds its batch for a bounded time and is answered with "error budget". Replies to the clients
+     * of the socket are queued and sent without blocking, a client that stops reading them only holds itself up.
+     */
+    class RequestServer {
+    public:
+        static const int MAX_BATCH = 256; /**< Maximum number of requests of one batch. */
+        static const size_t MAX_LINE = 4096; /**< Maximum length of a request line, longer lines are answered with an error. */
+        static const int MAX_COUNT_LIMIT = 1000; /**< Maximum solution limit of a count request. */
+        static const uint64_t DEFAULT_NODE_LIMIT = 1000000; /**< Node limit of every solve and count unless setNodeLimit says otherwise. */
+        static const size_t MAX_OUTBOX = 1 << 20; /**< Maximum number of reply bytes queued for a client, a client that falls further behind is disconnected. */
+        static const int SHUTDOWN_TIMEOUT_MS = 1000; /**< Time the queued replies get to reach the clients after a shutdown request. */
+
+        /**
+         * @brief Constructor.
+         * @param engine The search engine of the solve, count and generate requests.
+         * @param thread_count The number of threads a batch is solved on. 0 uses every hardware thread.
+         */
+        RequestServer(Sudoku::SolverEngine engine, int thread_count);
+
+        /**
+         * @brief Getter for the number of threads.
+         * @return The number of threads a batch is solved on.
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Makes the solve requests look the puzzles up in a solution cache, see SudokuEngine::setCacheCapacity.
+         * @param capacity The maximum number of cached puzzles, 0 to solve without a cache.
+         */
+        void setCacheCapacity(size_t capacity);
+
+        /**
+         * @brief Bounds the search of every solve and count request, see SudokuEngine::setNodeLimit.
+         * @param node_limit The maximum number of nodes of one request, 0 for unbounded searches.
+         */
+        void setNodeLimit(uint64_t node_limit);
+
+        /**
+         * @brief Serves one client through a pair of streams, e.g. the standard input and output, until the input ends
+         * or a shutdown request.
+         * @details Lines after a shutdown request are not answered. A stream cannot be interrupted, so the call returns
+         * once the next line is read or the input ends, a client closes its end after the shutdown request.
+         * @param in The stream of requests.
+         * @param out The stream of replies, flushed after every batch.
+         * @return The counters of the call.
+         */
+        ServerStats serve(std::istream& in, std::ostream& out);
+
+        /**
+         * @brief Listens on a Unix domain socket and serves every client that connects, until a shutdown request.
+         * @details An existing socket file is replaced, the file is removed when the server stops. Requests of all clients
+         * are batched together. Not available on Windows.
+         * @param path The path of the socket.
+         * @return The counters of the call.
+         * @throw std::runtime_error if the socket cannot be created
+         */
+        ServerStats serveSocket(const std::string& path);
+
+    private:
+        /**
+         * @brief Reply side of a client.
+         */
+        struct Connection {
+            std::function<void(const std::string&)> write; /**< Writes a block of reply lines. */
+        };
+
+        /**
+         * @brief A client of the socket.
+         */
+        struct SocketClient {
+            int fd = -1; /**< The connected socket. */
+            std::thread reader; /**< Reads the requests of the client. */
+            std::string outbox; /**< Replies the socket did not take yet. */
+            bool answered = false; /**< Set once the reader stopped and every request of the client was answered. */
+            bool dropped = false; /**< Set if the client is gone or fell behind MAX_OUTBOX, its replies are discarded. */
+        };
+
+        /**
+         * @brief A request line and the client it came from.
+         */
+        struct Request {
+            std::shared_ptr<Connection> connection; /**< Client the reply goes to. */
+            std::string line; /**< The request line, without the line terminator. */
+            bool too_long = false; /**< Whether the line was cut at MAX_LINE. */
+        };
+
+        /**
+         * @brief A parsed request of a batch.
+         */
+        struct Task {
+            std::string id; /**< Id of the request. */
+            std::string reply; /**< The reply line, without the id. */
+            Sudoku::Board board; /**< Board of a solve request, board of a generate request once generated. */
+            Sudoku::Difficulty difficulty = Sudoku::MEDIUM; /**< Difficulty of a generate request. */
+            bool unique = false; /**< Uniqueness of a generate request. */
+            uint64_t seed = 0; /**< Seed of a generate request. */
+            enum Kind { DONE, SOLVE, GENERATE, SHUTDOWN } kind = DONE; /**< Whether the reply still waits for the engine, or stops the server. */
+        };
+
+        Sudoku::SudokuEngine engine; /**< Engine of every request. */
+
+        std::mutex mutex; /**< Guards the queue and the flags below. */
+        std::condition_variable ready; /**< Signalled when a request is queued or the producers are done. */
+        std::deque<Request> queue; /**< Requests waiting for the processing thread. */
+        int producers; /**< Number of readers that can still queue requests. */
+        bool stopping; /**< Set by a shutdown request. */
+        std::function<void()> on_shutdown; /**< Wakes up the readers and the listener of the current call. */
+        ServerStats stats; /**< Counters of the current call. */
+
+        /**
+         * @brief Resets the queue, the flags and the counters for a new call.
+         * @param producers The number of readers the call starts with.
+         */
+        void reset(int producers);
+
+        /**
+         * @brief Queues a request line.
+         * @param request The request.
+         * @return False if the server is stopping and the reader should stop.
+         */
+        bool push(Request request);
+
+        /**
+         * @brief Marks a reader as done. The processing thread stops when every reader is done and the queue is empty.
+         */
+        void finishProducer();
+
+        /**
+         * @brief Adds a reader, e.g. for a new client of the socket.
+         * @return False if the server is stopping and the reader must not start.
+         */
+        bool addProducer();
+
+        /**
+         * @brief Body of the processing thread: takes batches off the queue until it is drained and every reader is done.
+         */
+        void processLoop();
+
+        /**
+         * @brief Answers the requests of a batch and writes the replies.
+         * @param batch The requests.
+         */
+        void processBatch(std::vector<Request>& batch);
+
+        /**
+         * @brief Parses a request and answers it right away unless it needs the engine.
+         * @param request The request.
+         * @param task Set to the parsed request.
+         */
+        void parse(const Request& request, Task& task);
+
+        /**
+         * @brief Sends as much of the outbox of a socket client as the socket takes without blocking.
+         * @details Drops the client if the socket fails or the outbox stays above MAX_OUTBOX. Not available on Windows.
+         * @param client The client, guarded by the caller.
+         */
+        static void sendOutbox(SocketClient& client);
+
+        /**
+         * @brief Splits a line into tokens separated by spaces or tabs.
+         * @param line The line.
+         * @return The tokens.
+         */
+        static std::vector<std::string> split(const std::string& line);
+
+        /**
+         * @brief Parses a decimal argument.
+         * @param token The argument.
+         * @param value Set to the value.
+         * @return False if the argument is not an unsigned decimal number that fits 64 bits.
+         */
+        static bool parseUnsigned(const std::string& token, uint64_t& value);
+
+        /**
+         * @brief Parses a board argument.
+         * @param token The argument.
+         * @param board Set to the board.
+         * @return False if the argument is not a board in the line format.
+         */
+        static bool parseBoard(const std::string& token, Sudoku::Board& board);
+
+        /**
+         * @brief Formats a board in the line format.
+         * @param board The board.
+         * @return The 81 characters of the board.
+         */
+        static std::string formatBoard(const Sudoku::Board& board);
+    };
+}
@@ -0,0 +1,137 @@
+/**
+* @file BitboardSolver.cpp
+* @brief Implements the BitboardSolver.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include "BitboardSolver.hpp"
+#include "../Sudoku/Board.hpp"
+#include "../Constants.hpp"
+#include "../Bits.hpp"
+
+namespace Sudoku{
+	template<int BlockSize>
+	const typename BasicBitboardSolver<BlockSize>::CellUnits BasicBitboardSolver<BlockSize>::CELL_UNITS = BasicBitboardSolver<BlockSize>::buildCellUnits();
+
+	template<int BlockSize>
+	typename BasicBitboardSolver<BlockSize>::CellUnits BasicBitboardSolver<BlockSize>::buildCellUnits(){
+		CellUnits units;
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
+				int cell = i*SIZE + j;
+				units.row[cell] = static_cast<uint8_t>(i);
+				units.col[cell] = static_cast<uint8_t>(j);
+				units.block[cell] = static_cast<uint8_t>(BoardType::getBlockNum(i, j));
+			}
+		}
+		return units;
+	}
+
+	template<int BlockSize>
+	bool BasicBitboardSolver<BlockSize>::solve(const BoardType& start_board, BoardType& solution_board) const {
+		return this->solve(start_board, solution_board, nullptr);
+	}
+
+	template<int BlockSize>
+	bool BasicBitboardSolver<BlockSize>::solve(const BoardType& start_board, BoardType& solution_board, const std::atomic<bool>* cancel, SearchBudget* budget, SolverStats* stats) const {
+		State state;
+		state.empty_cnt = 0;
+		state.cancel = cancel;
+		state.budget = budget;
+		state.nodes = state.backtracks = 0;
+		state.max_depth = 0;
+		for(int i=0; i<SIZE; i++)
+			state.rows[i] = state.cols[i] = state.blocks[i] = 0;
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
+				int cell = i*SIZE + j;
+				if(start_board[i][j] == Constants::EMPTY_CELL){
+					state.empty[state.empty_cnt++] = static_cast<CellIndex>(cell);
+					continue;
+				}
+				// a character outside of the alphabet of the size is not a value, the board has no solution
+				int idx = Traits::index(start_board[i][j]);
+				if(idx < 0)
+					return false;
+				Mask bit = static_cast<Mask>(1u << idx);
+				state.values[cell] = static_cast<uint8_t>(idx);
+				state.rows[i] |= bit;
+				state.cols[j] |= bit;
+				state.blocks[BoardType::getBlockNum(i, j)] |= bit;
+			}
+		}
+
+		bool solved = this->search(state, 0);
+		if(stats){
+			stats->nodes += state.nodes;
+			stats->backtracks += state.backtracks;
+			stats->max_depth = std::max(stats->max_depth, state.max_depth);
+		}
+		if(!solved)
+			return false;
+
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++)
+				solution_board[i][j] = Traits::symbol(state.values[i*SIZE + j]);
+		}
+		return true;
+	}
+
+	template<int BlockSize>
+	bool BasicBitboardSolver<BlockSize>::search(State& state, int depth) const {
+		if(depth == state.empty_cnt) return true;
+		if(state.cancel && state.cancel->load(std::memory_order_relaxed)) return false;
+		if(state.budget && !state.budget->tick()) return false;
+		state.nodes++;
+		if(depth > state.max_depth)
+			state.max_depth = depth;
+
+		// pick the most constrained cell, stopping early on a dead end or a forced value
+		int best = -1, best_cnt = SIZE + 1;
+		Mask best_candidates = 0;
+		for(int e=depth; e<state.empty_cnt; e++){
+			int cell = state.empty[e];
+			Mask candidates = static_cast<Mask>(~(state.rows[CELL_UNITS.row[cell]] | state.cols[CELL_UNITS.col[cell]] | state.blocks[CELL_UNITS.block[cell]]) & FULL_MASK);
+			int cnt = Bits::popcount(candidates);
+			if(cnt < best_cnt){
+				best = e;
+				best_cnt = cnt;
+				best_candidates = candidates;
+				if(cnt <= 1) break;
+			}
+		}
+		if(best_cnt == 0) return false;
+
+		CellIndex tmp = state.empty[depth];
+		state.empty[depth] = state.empty[best];
+		state.empty[best] = tmp;
+
+		int cell = state.empty[depth];
+		int ri = CELL_UNITS.row[cell], ci = CELL_UNITS.col[cell], bi = CELL_UNITS.block[cell];
+		while(best_candidates){
+			int k = Bits::ctz(best_candidates);
+			Mask bit = static_cast<Mask>(1u << k);
+			best_candidates &= best_candidates - 1;
+
+			state.values[cell] = static_cast<uint8_t>(k);
+			state.rows[ri] |= bit;
+			state.cols[ci] |= bit;
+			state.blocks[bi] |= bit;
+			if(this->search(state, depth + 1))
+				return true;
+			state.rows[ri] &= ~bit;
+			state.cols[ci] &= ~bit;
+			state.blocks[bi] &= ~bit;
+			state.backtracks++;
+		}
+		return false;
+	}
+
+	// every supported size is compiled here, so the members stay out of the header
+	template class BasicBitboardSolver<2>;
+	template class BasicBitboardSolver<3>;
+	template class BasicBitboardSolver<4>;
+	template class BasicBitboardSolver<5>;
+}
@@ -0,0 +1,121 @@
+/**
+* @file BitboardSolver.hpp
+* @brief Defines the BitboardSolver class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include "../Sudoku/Board.hpp"
+#include "../Sudoku/BoardTraits.hpp"
+#include "../Constants.hpp"
+#include "SearchBudget.hpp"
+#include "SolverStats.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Sudoku solver engine that works on packed bitmasks instead of the character board.
+     *
+     * @details Every row, column and block is described by a single mask of the digits it already contains,
+     * so the candidates of a cell are obtained with two ORs and a complement. The search always continues
+     * from the empty cell with the fewest candidates and enumerates digits by popping the lowest set bit.
+     *
+     * The board size is a template parameter, so every size gets its own loop bounds and the narrowest mask
+     * of its BoardTraits. The members are instantiated in BitboardSolver.cpp for every supported size.
+     *
+     * @tparam BlockSize Number of rows and columns of a block.
+     */
+    template<int BlockSize>
+    class BasicBitboardSolver {
+    public:
+        typedef BasicBoard<BlockSize> BoardType; /**< Board of the solved size. */
+        typedef typename BoardTraits<BlockSize>::Mask Mask; /**< Digit mask of a single unit. Bit k is set if the k-th digit of the alphabet is present. */
+
+        /**
+         * @brief Solves the Sudoku puzzle starting from the given board and updates the solution_board.
+         *
+         * @details Assumes that \p start_board is valid. If no solution exists or a cell holds a character outside of the
+         * alphabet of the board size, it returns false and the \p solution_board is not changed.
+         *
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         *
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool solve(const BoardType& start_board, BoardType& solution_board) const;
+
+        /**
+         * @brief Solves the Sudoku puzzle unless the search is cancelled.
+         *
+         * @details Same as solve(const BoardType&, BoardType&), but gives up and returns false as soon as \p cancel is set
+         * or \p budget is exhausted.
+         *
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         * @param cancel Flag checked at every node of the search. May be nullptr.
+         * @param budget Budget every node of the search is counted against. May be nullptr.
+         * @param stats Stats the nodes, backtracks and depth of the search are added to. May be nullptr. The time is not measured.
+         *
+         * @return True if a solution was found before the search was cancelled, false otherwise.
+         */
+        bool solve(const BoardType& start_board, BoardType& solution_board, const std::atomic<bool>* cancel, SearchBudget* budget = nullptr, SolverStats* stats = nullptr) const;
+
+    private:
+        typedef BoardTraits<BlockSize> Traits; /**< Dimensions and alphabet of the board. */
+        typedef typename Traits::CellIndex CellIndex; /**< Index of a cell. */
+
+        static const int SIZE = Traits::BOARD_SIZE; /**< Number of rows, columns, blocks and digits. */
+        static const int CELL_COUNT = Traits::CELL_COUNT; /**< Number of cells on the board. */
+        static const Mask FULL_MASK = static_cast<Mask>((1ull << SIZE) - 1); /**< Mask with every digit of the alphabet set. */
+
+        /**
+         * @brief Row, column and block index of every cell, so the search never divides.
+         */
+        struct CellUnits {
+            uint8_t row[CELL_COUNT];
+            uint8_t col[CELL_COUNT];
+            uint8_t block[CELL_COUNT];
+        };
+
+        static const CellUnits CELL_UNITS; /**< Unit indices of every cell. */
+
+        /**
+         * @brief Builds the CELL_UNITS table.
+         * @return The unit indices of every cell.
+         */
+        static CellUnits buildCellUnits();
+
+        /**
+         * @brief Search state. Kept on the stack so one solver can be used from several threads.
+         */
+        struct State {
+            Mask rows[SIZE]; /**< Digits present in each row. */
+            Mask cols[SIZE]; /**< Digits present in each column. */
+            Mask blocks[SIZE]; /**< Digits present in each block. */
+            uint8_t values[CELL_COUNT]; /**< Alphabet index of each filled cell. */
+            CellIndex empty[CELL_COUNT]; /**< Indices of the cells that are still empty. Cells before the search depth are filled. */
+            int empty_cnt; /**< Number of valid entries in empty. */
+            const std::atomic<bool>* cancel; /**< Flag that stops the search when set, or nullptr. */
+            SearchBudget* budget; /**< Budget that stops the search when exhausted, or nullptr. */
+            long long nodes; /**< Search nodes visited. */
+            long long backtracks; /**< Values taken back after a failed search. */
+            int max_depth; /**< Deepest search depth reached. */
+        };
+
+        /**
+         * @brief Recursively fills the empty cells starting from the given depth.
+         * @param state The current search state.
+         * @param depth Number of the empty cells that are already filled.
+         * @return True if the puzzle is successfully solved, false otherwise.
+         */
+        bool search(State& state, int depth) const;
+    };
+
+    /**
+     * @brief Bitmask engine of the 9x9 SudokuSolver.
+     */
+    typedef BasicBitboardSolver<Constants::BLOCK_SIZE> BitboardSolver;
+}
@@ -0,0 +1,126 @@
+/**
+* @file ConstraintPropagator.cpp
+* @brief Implements the ConstraintPropagator.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <bitset>
+#include "ConstraintPropagator.hpp"
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Constants.hpp"
+#include "../Bits.hpp"
+
+using Constants::BOARD_SIZE;
+using Constants::BLOCK_SIZE;
+
+namespace Sudoku{
+	bool ConstraintPropagator::propagate(MarkedBoard& board, Trail& trail, PropagationCounters& counters) const {
+		bool changed = true;
+		while(changed){
+			changed = false;
+			if(!this->nakedSingles(board, trail, counters, changed))
+				return false;
+			if(changed)
+				continue; // naked singles are cheaper, exhaust them first
+			if(!this->hiddenSingles(board, trail, counters, changed))
+				return false;
+		}
+		return true;
+	}
+
+	void ConstraintPropagator::undo(MarkedBoard& board, Trail& trail, int size) const {
+		while(trail.size > size){
+			const Placement& p = trail.placements[--trail.size];
+			board.removeValue(p.row, p.col, p.k);
+		}
+	}
+
+	void ConstraintPropagator::place(MarkedBoard& board, Trail& trail, int rowIdx, int colIdx, int k) const {
+		board.placeValue(rowIdx, colIdx, k);
+		Placement& p = trail.placements[trail.size++];
+		p.row = static_cast<uint8_t>(rowIdx);
+		p.col = static_cast<uint8_t>(colIdx);
+		p.k = static_cast<uint8_t>(k);
+	}
+
+	bool ConstraintPropagator::nakedSingles(MarkedBoard& board, Trail& trail, PropagationCounters& counters, bool& changed) const {
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(board[i][j] != Constants::EMPTY_CELL)
+					continue;
+				int cnt = board.getCandidateCount(i, j);
+				if(cnt == 0)
+					return false;
+				if(cnt > 1)
+					continue;
+				int k = Bits::ctz(static_cast<uint32_t>(board.getCandidates(i, j).to_ulong()));
+				this->place(board, trail, i, j, k);
+				counters.naked_singles++;
+				changed = true;
+			}
+		}
+		return true;
+	}
+
+	bool ConstraintPropagator::hiddenSingles(MarkedBoard& board, Trail& trail, PropagationCounters& counters, bool& changed) const {
+		const uint32_t full_mask = (1u << BOARD_SIZE) - 1;
+
+		// unit u: rows for u < BOARD_SIZE, then columns, then blocks
+		auto cellOf = [](int u, int t, int& ri, int& ci){
+			int idx = u % BOARD_SIZE;
+			if(u < BOARD_SIZE){
+				ri = idx; ci = t;
+			} else if(u < 2*BOARD_SIZE){
+				ri = t; ci = idx;
+			} else {
+				ri = (idx/BLOCK_SIZE)*BLOCK_SIZE + t/BLOCK_SIZE;
+				ci = (idx%BLOCK_SIZE)*BLOCK_SIZE + t%BLOCK_SIZE;
+			}
+		};
+
+		// Candidates are taken once per pass. Placements only remove candidates, so a value seen in a single
+		// cell of a unit is still a hidden single if that cell can take it, and a missed one is found next pass.
+		uint32_t cell_candidates[BOARD_SIZE][BOARD_SIZE];
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				cell_candidates[i][j] = board[i][j] == Constants::EMPTY_CELL ?
+					static_cast<uint32_t>(board.getCandidates(i, j).to_ulong()) : 0;
+			}
+		}
+
+		for(int u=0; u<3*BOARD_SIZE; u++){
+			// values that are a candidate in at least one / at least two cells of the unit
+			uint32_t once = 0, twice = 0;
+			for(int t=0; t<BOARD_SIZE; t++){
+				int ri, ci;
+				cellOf(u, t, ri, ci);
+				twice |= once & cell_candidates[ri][ci];
+				once |= cell_candidates[ri][ci];
+			}
+			const std::bitset<BOARD_SIZE>& present = u < BOARD_SIZE ? board.rowSets[u] :
+				u < 2*BOARD_SIZE ? board.colSets[u - BOARD_SIZE] : board.blockSets[u - 2*BOARD_SIZE];
+			if((once | static_cast<uint32_t>(present.to_ulong())) != full_mask)
+				return false;
+			uint32_t hidden = once & ~twice;
+			while(hidden){
+				int k = Bits::ctz(hidden);
+				hidden &= hidden - 1;
+				for(int t=0; t<BOARD_SIZE; t++){
+					int ri, ci;
+					cellOf(u, t, ri, ci);
+					if(!(cell_candidates[ri][ci] >> k & 1u))
+						continue;
+					// an earlier placement may have taken the cell or the value, the next pass catches that
+					if(board[ri][ci] == Constants::EMPTY_CELL && board.isCandidate(ri, ci, k)){
+						this->place(board, trail, ri, ci, k);
+						counters.hidden_singles++;
+						changed = true;
+					}
+					break;
+				}
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,98 @@
+/**
+* @file ConstraintPropagator.hpp
+* @brief Defines the ConstraintPropagator class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Number of cells resolved by each propagation rule.
+     */
+    struct PropagationCounters {
+        long long naked_singles = 0; /**< Cells filled because they had a single candidate. */
+        long long hidden_singles = 0; /**< Cells filled because they were the only place for a value in a row, column or block. */
+    };
+
+    /**
+     * @brief Applies naked and hidden singles to a MarkedBoard until neither rule fills a cell.
+     *
+     * @details Every value written by the propagator is recorded on a Trail, so the caller can take
+     * the board back to an earlier state when the search backtracks.
+     */
+    class ConstraintPropagator {
+        static_assert(BOARD_SIZE <= 32, "ConstraintPropagator masks hold at most 32 values.");
+
+    public:
+        /**
+         * @brief A cell filled by the propagator.
+         */
+        struct Placement {
+            uint8_t row; /**< Row index of the cell. */
+            uint8_t col; /**< Column index of the cell. */
+            uint8_t k; /**< Index of the written value in Constants::ALPHABET. */
+        };
+
+        /**
+         * @brief Fixed size stack of placements. Every cell is filled at most once along a search path.
+         */
+        struct Trail {
+            Placement placements[BOARD_SIZE*BOARD_SIZE]; /**< Placements in the order they were made. */
+            int size = 0; /**< Number of valid placements. */
+        };
+
+        /**
+         * @brief Fills every cell forced by the naked and hidden single rules.
+         * @param board The board to propagate on. Its marks must be up to date.
+         * @param trail The trail the placements are pushed to.
+         * @param counters The counters updated with the number of cells resolved by each rule.
+         * @return false if a contradiction was found (a cell or a value with no place left), true otherwise.
+         */
+        bool propagate(MarkedBoard& board, Trail& trail, PropagationCounters& counters) const;
+
+        /**
+         * @brief Clears the cells placed after the trail had \p size entries.
+         * @param board The board the placements were made on.
+         * @param trail The trail holding the placements.
+         * @param size The trail size to go back to.
+         */
+        void undo(MarkedBoard& board, Trail& trail, int size) const;
+
+    private:
+        /**
+         * @brief Fills every empty cell that has exactly one candidate.
+         * @param board The board to propagate on.
+         * @param trail The trail the placements are pushed to.
+         * @param counters The counters to update.
+         * @param changed Set to true if a cell was filled.
+         * @return false if an empty cell with no candidates was found, true otherwise.
+         */
+        bool nakedSingles(MarkedBoard& board, Trail& trail, PropagationCounters& counters, bool& changed) const;
+
+        /**
+         * @brief Fills every cell that is the only place for some value in one of its units.
+         * @param board The board to propagate on.
+         * @param trail The trail the placements are pushed to.
+         * @param counters The counters to update.
+         * @param changed Set to true if a cell was filled.
+         * @return false if a value has no place left in some unit, true otherwise.
+         */
+        bool hiddenSingles(MarkedBoard& board, Trail& trail, PropagationCounters& counters, bool& changed) const;
+
+        /**
+         * @brief Writes a value to the board and records it on the trail.
+         * @param board The board to write to.
+         * @param trail The trail the placement is pushed to.
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @param k The index of the value in Constants::ALPHABET.
+         */
+        void place(MarkedBoard& board, Trail& trail, int rowIdx, int colIdx, int k) const;
+    };
+}
@@ -0,0 +1,211 @@
+/**
+* @file DancingLinks.cpp
+* @brief Implements the DancingLinks solver.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include <vector>
+#include "DancingLinks.hpp"
+#include "../Sudoku/Board.hpp"
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Constants.hpp"
+
+using Constants::BOARD_SIZE;
+
+namespace Sudoku{
+	DancingLinks::DancingLinks() : limit(0), solution_cnt(0), cancel(nullptr), budget(nullptr), stats(nullptr) {
+		const int node_cnt = 1 + COLUMN_COUNT + 4*ROW_COUNT;
+		this->left.resize(node_cnt);
+		this->right.resize(node_cnt);
+		this->up.resize(node_cnt);
+		this->down.resize(node_cnt);
+		this->column.resize(node_cnt);
+		this->choice.resize(node_cnt, -1);
+		this->size.resize(1 + COLUMN_COUNT, 0);
+		this->first_node.resize(ROW_COUNT);
+		this->solution.reserve(CELL_COUNT);
+		this->found.reserve(CELL_COUNT);
+		this->givens.reserve(CELL_COUNT);
+
+		// root and column headers form the horizontal header list
+		for(int h=0; h<=COLUMN_COUNT; h++){
+			this->left[h] = h == 0 ? COLUMN_COUNT : h - 1;
+			this->right[h] = h == COLUMN_COUNT ? 0 : h + 1;
+			this->up[h] = this->down[h] = this->column[h] = h;
+		}
+
+		int node = COLUMN_COUNT + 1;
+		for(int r=0; r<BOARD_SIZE; r++){
+			for(int c=0; c<BOARD_SIZE; c++){
+				int b = Board::getBlockNum(r, c);
+				for(int k=0; k<BOARD_SIZE; k++){
+					int ch = (r*BOARD_SIZE + c)*BOARD_SIZE + k;
+					const int headers[4] = {
+						1 + r*BOARD_SIZE + c,
+						1 + CELL_COUNT + r*BOARD_SIZE + k,
+						1 + 2*CELL_COUNT + c*BOARD_SIZE + k,
+						1 + 3*CELL_COUNT + b*BOARD_SIZE + k
+					};
+					this->first_node[ch] = node;
+					for(int t=0; t<4; t++, node++){
+						int h = headers[t];
+						// append at the bottom of the column
+						this->column[node] = h;
+						this->choice[node] = ch;
+						this->up[node] = this->up[h];
+						this->down[node] = h;
+						this->down[this->up[h]] = node;
+						this->up[h] = node;
+						this->size[h]++;
+						// circular row of 4 nodes
+						this->left[node] = t == 0 ? node + 3 : node - 1;
+						this->right[node] = t == 3 ? node - 3 : node + 1;
+					}
+				}
+			}
+		}
+	}
+
+	void DancingLinks::setCancelFlag(const std::atomic<bool>* cancel){
+		this->cancel = cancel;
+	}
+
+	void DancingLinks::setSearchBudget(SearchBudget* budget){
+		this->budget = budget;
+	}
+
+	void DancingLinks::setStats(SolverStats* stats){
+		this->stats = stats;
+	}
+
+	void DancingLinks::cover(int col){
+		this->right[this->left[col]] = this->right[col];
+		this->left[this->right[col]] = this->left[col];
+		for(int i=this->down[col]; i!=col; i=this->down[i]){
+			for(int j=this->right[i]; j!=i; j=this->right[j]){
+				this->down[this->up[j]] = this->down[j];
+				this->up[this->down[j]] = this->up[j];
+				this->size[this->column[j]]--;
+			}
+		}
+	}
+
+	void DancingLinks::uncover(int col){
+		for(int i=this->up[col]; i!=col; i=this->up[i]){
+			for(int j=this->left[i]; j!=i; j=this->left[j]){
+				this->size[this->column[j]]++;
+				this->down[this->up[j]] = j;
+				this->up[this->down[j]] = j;
+			}
+		}
+		this->right[this->left[col]] = col;
+		this->left[this->right[col]] = col;
+	}
+
+	bool DancingLinks::selectGivens(const Board& board){
+		this->givens.clear();
+		for(int r=0; r<BOARD_SIZE; r++){
+			for(int c=0; c<BOARD_SIZE; c++){
+				if(board[r][c] == Constants::EMPTY_CELL)
+					continue;
+				int k = Constants::keyIndex(board[r][c]);
+				if(k < 0)
+					return false;
+				int ch = (r*BOARD_SIZE + c)*BOARD_SIZE + k;
+				int first = this->first_node[ch];
+				// a column that is no longer in the header list was already covered by another given
+				for(int j=first, t=0; t<4; j=this->right[j], t++){
+					int h = this->column[j];
+					if(this->right[this->left[h]] != h)
+						return false;
+				}
+				for(int j=first, t=0; t<4; j=this->right[j], t++)
+					this->cover(this->column[j]);
+				this->givens.push_back(ch);
+			}
+		}
+		return true;
+	}
+
+	void DancingLinks::releaseGivens(){
+		while(!this->givens.empty()){
+			int first = this->first_node[this->givens.back()];
+			this->givens.pop_back();
+			for(int j=this->left[first], t=0; t<4; j=this->left[j], t++)
+				this->uncover(this->column[j]);
+		}
+	}
+
+	void DancingLinks::search(){
+		if(this->right[ROOT] == ROOT){
+			if(this->solution_cnt++ == 0)
+				this->found = this->solution;
+			return;
+		}
+		if(this->cancel && this->cancel->load(std::memory_order_relaxed))
+			return;
+		if(this->budget && !this->budget->tick())
+			return;
+		if(this->stats){
+			this->stats->nodes++;
+			this->stats->max_depth = std::max(this->stats->max_depth, static_cast<int>(this->solution.size()));
+		}
+
+		// Knuth's S heuristic: branch on the constraint with the fewest options
+		int col = this->right[ROOT];
+		for(int h=this->right[col]; h!=ROOT; h=this->right[h]){
+			if(this->size[h] < this->size[col])
+				col = h;
+		}
+		if(this->size[col] == 0)
+			return;
+
+		this->cover(col);
+		for(int i=this->down[col]; i!=col && this->solution_cnt<this->limit; i=this->down[i]){
+			this->solution.push_back(this->choice[i]);
+			for(int j=this->right[i]; j!=i; j=this->right[j])
+				this->cover(this->column[j]);
+			this->search();
+			for(int j=this->left[i]; j!=i; j=this->left[j])
+				this->uncover(this->column[j]);
+			this->solution.pop_back();
+			if(this->stats && this->solution_cnt < this->limit)
+				this->stats->backtracks++;
+		}
+		this->uncover(col);
+	}
+
+	int DancingLinks::countSolutions(const Board& board, int limit){
+		this->solution_cnt = 0;
+		if(this->selectGivens(board)){
+			this->limit = limit;
+			this->search();
+		}
+		this->releaseGivens();
+		return this->solution_cnt;
+	}
+
+	bool DancingLinks::solve(const Board& start_board, MarkedBoard& solution_board){
+		return this->solve(start_board, solution_board, 1) > 0;
+	}
+
+	int DancingLinks::solve(const Board& start_board, MarkedBoard& solution_board, int limit){
+		solution_board = start_board;
+		int solution_cnt = this->countSolutions(start_board, limit);
+		if(solution_cnt == 0)
+			return 0;
+		for(int ch : this->found){
+			int cell = ch / BOARD_SIZE;
+			solution_board[cell / BOARD_SIZE][cell % BOARD_SIZE] = Constants::ALPHABET[ch % BOARD_SIZE];
+		}
+		// the board is full at this point, so every unit contains the whole alphabet
+		for(int i=0; i<BOARD_SIZE; i++){
+			solution_board.rowSets[i].set();
+			solution_board.colSets[i].set();
+			solution_board.blockSets[i].set();
+		}
+		return solution_cnt;
+	}
+}
@@ -0,0 +1,139 @@
+/**
+* @file DancingLinks.hpp
+* @brief Defines the DancingLinks class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include "../Sudoku/Board.hpp"
+#include "../Sudoku/MarkedBoard.hpp"
+#include "../Constants.hpp"
+#include "SearchBudget.hpp"
+#include "SolverStats.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Exact cover Sudoku solver using Knuth's Algorithm X with dancing links.
+     *
+     * @details Every (row, column, value) choice is a matrix row covering four constraints: the cell is filled,
+     * and the value is present in its row, column and block. The whole matrix is built once in the constructor
+     * and every call covers the givens, searches and uncovers everything again, so the node pool is reused
+     * across puzzles without any allocation.
+     *
+     * An instance is not safe to use from several threads at the same time.
+     */
+    class DancingLinks {
+    public:
+        /**
+         * @brief Constructor. Allocates and links the node pool of the exact cover matrix.
+         */
+        DancingLinks();
+
+        /**
+         * @brief Solves the Sudoku puzzle starting from the given board and updates the solution_board.
+         *
+         * @details If no solution exists, it returns false and the \p solution_board is left equal to the \p start_board.
+         *
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         *
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool solve(const Board& start_board, MarkedBoard& solution_board);
+
+        /**
+         * @brief Solves the board like solve and goes on with the same search until \p limit solutions are found.
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the first solution, left equal to \p start_board if there is none.
+         * @param limit The maximum number of solutions to look for.
+         * @return The number of solutions if it is less than \p limit, \p limit otherwise, like countSolutions.
+         */
+        int solve(const Board& start_board, MarkedBoard& solution_board, int limit);
+
+        /**
+         * @brief Counts the solutions of the given board, stopping as soon as \p limit solutions are found.
+         * @param board The board to count the solutions of.
+         * @param limit The maximum number of solutions to look for.
+         * @return The number of solutions if it is less than \p limit, \p limit otherwise. 0 if the givens contradict each other.
+         */
+        int countSolutions(const Board& board, int limit);
+
+        /**
+         * @brief Sets a flag that stops solve and countSolutions as soon as it is set.
+         * @details A cancelled solve returns false and a cancelled count returns the solutions found so far.
+         * @param cancel Flag checked at every node of the search, or nullptr to never cancel.
+         */
+        void setCancelFlag(const std::atomic<bool>* cancel);
+
+        /**
+         * @brief Sets a budget that every node of solve and countSolutions is counted against.
+         * @details The search stops as soon as the budget is exhausted, the same way as when it is cancelled.
+         * @param budget The budget, or nullptr for an unbounded search.
+         */
+        void setSearchBudget(SearchBudget* budget);
+
+        /**
+         * @brief Sets stats that the nodes, backtracks and depth of solve and countSolutions are added to.
+         * @details The depth of a node is the number of matrix rows chosen on its path, the givens excluded. The time is not measured.
+         * @param stats The stats, or nullptr to count nothing.
+         */
+        void setStats(SolverStats* stats);
+
+    private:
+        static const int CELL_COUNT = BOARD_SIZE * BOARD_SIZE; /**< Number of cells on the board. */
+        static const int COLUMN_COUNT = 4 * CELL_COUNT; /**< Number of constraints. */
+        static const int ROW_COUNT = CELL_COUNT * BOARD_SIZE; /**< Number of (row, column, value) choices. */
+        static const int ROOT = 0; /**< Index of the root header node. Column headers follow it. */
+
+        std::vector<int> left; /**< Left neighbour of each node. */
+        std::vector<int> right; /**< Right neighbour of each node. */
+        std::vector<int> up; /**< Upper neighbour of each node. */
+        std::vector<int> down; /**< Lower neighbour of each node. */
+        std::vector<int> column; /**< Column header of each node. */
+        std::vector<int> choice; /**< Matrix row (choice) of each node. */
+        std::vector<int> size; /**< Number of nodes in each column, indexed by the column header. */
+        std::vector<int> first_node; /**< First node of each matrix row. */
+
+        std::vector<int> givens; /**< Choices selected by selectGivens, in the order they were covered. */
+        std::vector<int> solution; /**< Choices of the current search path. */
+        std::vector<int> found; /**< Choices of the first solution found. */
+        int limit; /**< Number of solutions the current search stops at. */
+        int solution_cnt; /**< Number of solutions found by the current search. */
+        const std::atomic<bool>* cancel; /**< Flag that stops the search when set, or nullptr. */
+        SearchBudget* budget; /**< Budget that stops the search when exhausted, or nullptr. */
+        SolverStats* stats; /**< Stats the search is counted in, or nullptr. */
+
+        /**
+         * @brief Removes a column and every row that intersects it from the matrix.
+         * @param col The column header.
+         */
+        void cover(int col);
+
+        /**
+         * @brief Reverses cover. Columns must be uncovered in the reverse order of covering.
+         * @param col The column header.
+         */
+        void uncover(int col);
+
+        /**
+         * @brief Covers the columns of the givens of the board.
+         * @param board The board whose givens are selected.
+         * @return false if two givens contradict each other or a given is not in the alphabet, true otherwise.
+         */
+        bool selectGivens(const Board& board);
+
+        /**
+         * @brief Reverses selectGivens, leaving the matrix as it was built.
+         */
+        void releaseGivens();
+
+        /**
+         * @brief Recursively searches for exact covers of the remaining columns.
+         */
+        void search();
+    };
+}
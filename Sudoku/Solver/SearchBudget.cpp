@@ -0,0 +1,47 @@
+/**
+* @file SearchBudget.cpp
+* @brief Implements the SearchBudget.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include "SearchBudget.hpp"
+
+namespace Sudoku{
+	SearchBudget::SearchBudget() : nodes(0), node_limit(0), deadline(), has_deadline(false), is_exhausted(false) {}
+
+	void SearchBudget::setNodeLimit(uint64_t node_limit){
+		this->node_limit = node_limit;
+	}
+
+	void SearchBudget::setDeadline(Clock::time_point deadline){
+		this->deadline = deadline;
+		this->has_deadline = true;
+		// an expired deadline stops the very first node instead of the first clock read
+		if(Clock::now() >= deadline)
+			this->is_exhausted = true;
+	}
+
+	void SearchBudget::setTimeLimit(Clock::duration time_limit){
+		this->setDeadline(Clock::now() + time_limit);
+	}
+
+	uint64_t SearchBudget::getNodes() const {
+		return this->nodes;
+	}
+
+	bool SearchBudget::exhausted() const {
+		return this->is_exhausted;
+	}
+
+	bool SearchBudget::poll(){
+		if(this->has_deadline && !this->is_exhausted && Clock::now() >= this->deadline)
+			this->is_exhausted = true;
+		return !this->is_exhausted;
+	}
+
+	bool SearchBudget::exhaust(){
+		this->is_exhausted = true;
+		return false;
+	}
+}
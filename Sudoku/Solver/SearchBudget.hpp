@@ -0,0 +1,95 @@
+/**
+* @file SearchBudget.hpp
+* @brief Defines the SearchBudget class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Sudoku {
+    /**
+     * @brief Bounds a search by a number of nodes, a wall-clock deadline or both, and counts the nodes searched.
+     *
+     * @details The solver engines and the generator call tick at every node of their searches and give up as soon as it
+     * returns false. The clock is only read every CLOCK_INTERVAL nodes, so a deadline may be overrun by that many nodes.
+     * Once exhausted the budget stays exhausted. A budget is not safe to share between threads.
+     */
+    class SearchBudget {
+    public:
+        typedef std::chrono::steady_clock Clock; /**< Clock of the deadline. */
+
+        /**
+         * @brief Constructor. Constructs a budget without any limit, which only counts the nodes.
+         */
+        SearchBudget();
+
+        /**
+         * @brief Sets the maximum number of nodes.
+         * @param node_limit The number of nodes after which the budget is exhausted, 0 for no limit.
+         */
+        void setNodeLimit(uint64_t node_limit);
+
+        /**
+         * @brief Sets the wall-clock deadline.
+         * @param deadline The point in time after which the budget is exhausted.
+         */
+        void setDeadline(Clock::time_point deadline);
+
+        /**
+         * @brief Sets the deadline to the given time from now.
+         * @param time_limit The time the budget lasts.
+         */
+        void setTimeLimit(Clock::duration time_limit);
+
+        /**
+         * @brief Getter for the number of nodes counted so far.
+         * @return The number of calls of tick, including the one that exhausted the budget.
+         */
+        uint64_t getNodes() const;
+
+        /**
+         * @brief Checks if the budget ran out.
+         * @return true if a node limit or deadline was hit, false otherwise.
+         */
+        bool exhausted() const;
+
+        /**
+         * @brief Reads the clock right away instead of waiting for the next CLOCK_INTERVAL nodes.
+         * @details Meant for the points between searches, where a lot of work may happen without any node being counted.
+         * @return false if the budget is exhausted, true otherwise.
+         */
+        bool poll();
+
+        /**
+         * @brief Counts one search node.
+         * @return false if the budget is exhausted and the search has to give up, true otherwise.
+         */
+        bool tick(){
+            this->nodes++;
+            if(this->is_exhausted || (this->node_limit != 0 && this->nodes > this->node_limit))
+                return this->exhaust();
+            if(this->has_deadline && (this->nodes & (CLOCK_INTERVAL - 1)) == 0 && Clock::now() >= this->deadline)
+                return this->exhaust();
+            return true;
+        }
+
+    private:
+        static const uint64_t CLOCK_INTERVAL = 64; /**< Number of nodes between two reads of the clock. Power of two. */
+
+        uint64_t nodes; /**< Number of nodes counted so far. */
+        uint64_t node_limit; /**< Maximum number of nodes, 0 for no limit. */
+        Clock::time_point deadline; /**< Deadline of the search, only valid if has_deadline is set. */
+        bool has_deadline; /**< Indicates if the deadline is set. */
+        bool is_exhausted; /**< Set as soon as a limit is hit. */
+
+        /**
+         * @brief Marks the budget as exhausted.
+         * @return false, so tick can return it directly.
+         */
+        bool exhaust();
+    };
+}
@@ -0,0 +1,70 @@
+/**
+* @file SolutionCache.cpp
+* @brief Implements the SolutionCache.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <stdexcept>
+#include "SolutionCache.hpp"
+
+namespace Sudoku {
+	SolutionCache::SolutionCache(size_t capacity) : capacity(capacity) {
+		if(capacity == 0)
+			throw std::invalid_argument("The capacity of a solution cache must be at least 1.");
+	}
+
+	size_t SolutionCache::getCapacity() const {
+		return this->capacity;
+	}
+
+	size_t SolutionCache::size() const {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->entries.size();
+	}
+
+	std::string SolutionCache::makeKey(const Board& puzzle){
+		std::string key(BOARD_SIZE*BOARD_SIZE, Constants::EMPTY_CELL);
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++)
+				key[i*BOARD_SIZE + j] = puzzle[i][j];
+		}
+		return key;
+	}
+
+	bool SolutionCache::find(const Board& puzzle, Board& solution, bool& solvable){
+		std::string key = makeKey(puzzle);
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto found = this->index.find(key);
+		if(found == this->index.end())
+			return false;
+		this->entries.splice(this->entries.begin(), this->entries, found->second);
+		solvable = found->second->solvable;
+		if(solvable)
+			solution = found->second->solution;
+		return true;
+	}
+
+	void SolutionCache::insert(const Board& puzzle, const Board& solution, bool solvable){
+		std::string key = makeKey(puzzle);
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto found = this->index.find(key);
+		if(found != this->index.end()){
+			// another thread solved the same puzzle in the meantime
+			this->entries.splice(this->entries.begin(), this->entries, found->second);
+			return;
+		}
+		if(this->entries.size() == this->capacity){
+			this->index.erase(this->entries.back().key);
+			this->entries.pop_back();
+		}
+		this->entries.push_front(Entry{key, solution, solvable});
+		this->index.emplace(std::move(key), this->entries.begin());
+	}
+
+	void SolutionCache::clear(){
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->index.clear();
+		this->entries.clear();
+	}
+}
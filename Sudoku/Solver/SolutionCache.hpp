@@ -0,0 +1,96 @@
+/**
+* @file SolutionCache.hpp
+* @brief Defines the SolutionCache class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "../Sudoku/Board.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Least recently used cache of solved puzzles, keyed by the canonical form of the puzzle.
+     *
+     * @details The puzzles and solutions are stored in canonical orientation, see CanonicalForm, so one entry answers every
+     * puzzle that a BoardTransform turns into the same canonical puzzle. Puzzles without a solution are cached as well,
+     * SudokuSolver leaves out puzzles with more than one solution.
+     * When the cache is full, the entry that was looked up or inserted longest ago is dropped.
+     *
+     * Every call takes a lock, so one cache can be shared by the solvers of several threads.
+     */
+    class SolutionCache {
+    public:
+        /**
+         * @brief Constructor.
+         * @param capacity The maximum number of entries.
+         * @throw std::invalid_argument if \p capacity is 0
+         */
+        explicit SolutionCache(size_t capacity);
+
+        SolutionCache(const SolutionCache&) = delete;
+        SolutionCache& operator=(const SolutionCache&) = delete;
+
+        /**
+         * @brief Getter for the capacity.
+         * @return The maximum number of entries.
+         */
+        size_t getCapacity() const;
+
+        /**
+         * @brief Returns the number of entries.
+         * @return The number of cached puzzles.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Looks up a canonical puzzle and marks its entry as the most recently used one.
+         * @param puzzle The puzzle in canonical form.
+         * @param solution Set to the canonical solution if the puzzle is cached and has one.
+         * @param solvable Set to whether the puzzle has a solution if it is cached.
+         * @return True if the puzzle is cached.
+         */
+        bool find(const Board& puzzle, Board& solution, bool& solvable);
+
+        /**
+         * @brief Caches a canonical puzzle as the most recently used entry, dropping the least recently used one if the cache is full.
+         * @param puzzle The puzzle in canonical form.
+         * @param solution The solution in the same orientation as \p puzzle. Ignored if \p solvable is false.
+         * @param solvable Whether the puzzle has a solution.
+         */
+        void insert(const Board& puzzle, const Board& solution, bool solvable);
+
+        /**
+         * @brief Removes every entry.
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief A cached puzzle.
+         */
+        struct Entry {
+            std::string key; /**< Cells of the canonical puzzle. */
+            Board solution; /**< The canonical solution, if there is one. */
+            bool solvable; /**< Whether the puzzle has a solution. */
+        };
+
+        size_t capacity; /**< Maximum number of entries. */
+        mutable std::mutex mutex; /**< Guards the entries. */
+        std::list<Entry> entries; /**< The entries, most recently used first. */
+        std::unordered_map<std::string, std::list<Entry>::iterator> index; /**< Entry of every cached key. */
+
+        /**
+         * @brief Builds the key of a canonical puzzle.
+         * @param puzzle The puzzle.
+         * @return The cells of the puzzle, row by row.
+         */
+        static std::string makeKey(const Board& puzzle);
+    };
+}
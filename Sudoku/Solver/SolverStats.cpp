@@ -0,0 +1,28 @@
+/**
+* @file SolverStats.cpp
+* @brief Implements the SolverStats.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include "SolverStats.hpp"
+
+namespace Sudoku {
+	SolverStats& SolverStats::operator+=(const SolverStats& other){
+		this->solves += other.solves;
+		this->nodes += other.nodes;
+		this->backtracks += other.backtracks;
+		this->max_depth = std::max(this->max_depth, other.max_depth);
+		this->cache_hits += other.cache_hits;
+		this->propagation.naked_singles += other.propagation.naked_singles;
+		this->propagation.hidden_singles += other.propagation.hidden_singles;
+		this->time += other.time;
+		this->max_time = std::max(this->max_time, other.max_time);
+		return *this;
+	}
+
+	long long SolverStats::getPropagations() const {
+		return this->propagation.naked_singles + this->propagation.hidden_singles;
+	}
+}
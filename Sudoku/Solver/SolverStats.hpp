@@ -0,0 +1,46 @@
+/**
+* @file SolverStats.hpp
+* @brief Defines the SolverStats structure.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <chrono>
+#include "ConstraintPropagator.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Work done by the solver, for a single solve or added up over many.
+     *
+     * @details Every engine counts its own search tree: a node is a call of the recursive search, a backtrack is a value
+     * taken back after the search below it failed, and the depth is the number of values the search guessed or placed on
+     * the current path. Only the BACKTRACKING engine propagates, so the propagation counters of the other engines stay 0.
+     */
+    struct SolverStats {
+        typedef std::chrono::steady_clock Clock; /**< Clock of the solve times. */
+
+        long long solves = 0; /**< Number of solves the stats cover. */
+        long long nodes = 0; /**< Search nodes visited. */
+        long long backtracks = 0; /**< Values taken back after a failed search. */
+        int max_depth = 0; /**< Deepest search path of any solve. */
+        long long cache_hits = 0; /**< Solves answered by a SolutionCache without a search. */
+        PropagationCounters propagation; /**< Cells filled by each propagation rule, abandoned search paths included. */
+        Clock::duration time = Clock::duration::zero(); /**< Wall time of every solve added up. */
+        Clock::duration max_time = Clock::duration::zero(); /**< Wall time of the slowest solve. */
+
+        /**
+         * @brief Adds up the stats of other solves: the counts and times are summed, the maximums kept.
+         * @param other The stats to add.
+         * @return A reference to these stats.
+         */
+        SolverStats& operator+=(const SolverStats& other);
+
+        /**
+         * @brief Returns the number of cells filled by propagation.
+         * @return The naked and hidden singles together.
+         */
+        long long getPropagations() const;
+    };
+}
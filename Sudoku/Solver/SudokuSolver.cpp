@@ -14,31 +14,165 @@
 using Constants::BOARD_SIZE;
 
 namespace Sudoku{
-	bool SudokuSolver::solve(const Board& start_board, MarkedBoard& solution_board) const {
-		solution_board = start_board;
-		return this->solve(solution_board, 0, 0);
+	SudokuSolver::SudokuSolver() : engine(BACKTRACKING), cancel(nullptr), budget(nullptr), cache(nullptr) {}
+
+	SudokuSolver::SudokuSolver(SolverEngine engine) : engine(engine), cancel(nullptr), budget(nullptr), cache(nullptr) {}
+
+	void SudokuSolver::setEngine(SolverEngine engine){
+		this->engine = engine;
+	}
+
+	SolverEngine SudokuSolver::getEngine() const {
+		return this->engine;
+	}
+
+	void SudokuSolver::setCancelFlag(const std::atomic<bool>* cancel){
+		this->cancel = cancel;
+	}
+
+	void SudokuSolver::setSearchBudget(SearchBudget* budget){
+		this->budget = budget;
+	}
+
+	void SudokuSolver::setSolutionCache(SolutionCache* cache){
+		this->cache = cache;
+	}
+
+	bool SudokuSolver::solve(const Board& start_board, MarkedBoard& solution_board) {
+		SolverStats stats;
+		return this->solveCached(start_board, solution_board, stats);
+	}
+
+	bool SudokuSolver::solve(const Board& start_board, MarkedBoard& solution_board, PropagationCounters& counters) {
+		SolverStats stats;
+		bool solved = this->solveCached(start_board, solution_board, stats);
+		counters.naked_singles += stats.propagation.naked_singles;
+		counters.hidden_singles += stats.propagation.hidden_singles;
+		return solved;
+	}
+
+	bool SudokuSolver::solve(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats) {
+		SolverStats::Clock::time_point begin = SolverStats::Clock::now();
+		SolverStats call;
+		bool solved = this->solveCached(start_board, solution_board, call);
+		call.solves = 1;
+		call.time = call.max_time = SolverStats::Clock::now() - begin;
+		stats += call;
+		return solved;
 	}
 
-	bool SudokuSolver::solve(MarkedBoard& board, int ri, int ci) const {
-		while(ri < BOARD_SIZE && board[ri][ci] != Constants::EMPTY_CELL){
-			if(++ci == BOARD_SIZE){
-				ci = 0;
-				ri++;
+	bool SudokuSolver::solveCached(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats) {
+		if(!this->cache)
+			return this->runEngine(start_board, solution_board, stats);
+		if(!this->canonical_form)
+			this->canonical_form.reset(new CanonicalForm());
+		Board canonical, canonical_solution;
+		BoardTransform transform;
+		if(!this->canonical_form->canonicalize(start_board, canonical, transform))
+			return this->runEngine(start_board, solution_board, stats);
+
+		bool solvable = false;
+		if(this->cache->find(canonical, canonical_solution, solvable)){
+			stats.cache_hits++;
+			if(!solvable){
+				solution_board = start_board;
+				return false;
 			}
+			Board solution;
+			transform.revert(canonical_solution, solution);
+			solution_board = solution;
+			return true;
+		}
+		int solution_cnt = 0;
+		bool solved = this->runEngine(start_board, solution_board, stats, &solution_cnt);
+		// a search that was stopped early says nothing about the puzzle
+		if(!solved && this->stopped())
+			return false;
+		if(solved){
+			// a hit answers with the cached solution, so a puzzle with several would get whichever one was searched first
+			if(solution_cnt == 0 ? !this->provesUnique(start_board) : solution_cnt != 1)
+				return true;
+			transform.apply(solution_board, canonical_solution);
+		}
+		this->cache->insert(canonical, canonical_solution, solved);
+		return solved;
+	}
+
+	bool SudokuSolver::provesUnique(const Board& start_board){
+		if(!this->dancing_links)
+			this->dancing_links.reset(new DancingLinks());
+		// the count only decides what is cached, so it has its own budget and stays out of the stats of the solve
+		SearchBudget count_budget;
+		count_budget.setNodeLimit(UNIQUENESS_NODE_LIMIT);
+		this->dancing_links->setCancelFlag(this->cancel);
+		this->dancing_links->setSearchBudget(&count_budget);
+		int solution_cnt = this->dancing_links->countSolutions(start_board, 2);
+		this->dancing_links->setSearchBudget(nullptr);
+		return solution_cnt == 1 && !count_budget.exhausted() && !this->stopped();
+	}
+
+	bool SudokuSolver::stopped() const {
+		return (this->cancel && this->cancel->load(std::memory_order_relaxed)) || (this->budget && this->budget->exhausted());
+	}
+
+	bool SudokuSolver::runEngine(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats, int* solution_cnt) {
+		if(this->engine == BITBOARD){
+			if(!this->bitboard_solver.solve(start_board, solution_board, this->cancel, this->budget, &stats)){
+				solution_board = start_board;
+				return false;
+			}
+			// the board is full at this point, so every unit contains the whole alphabet
+			for(int i=0; i<BOARD_SIZE; i++){
+				solution_board.rowSets[i].set();
+				solution_board.colSets[i].set();
+				solution_board.blockSets[i].set();
+			}
+			return true;
+		}
+		if(this->engine == DANCING_LINKS){
+			if(!this->dancing_links)
+				this->dancing_links.reset(new DancingLinks());
+			this->dancing_links->setCancelFlag(this->cancel);
+			this->dancing_links->setSearchBudget(this->budget);
+			this->dancing_links->setStats(&stats);
+			// the search that found the solution goes on to a second one, so the cache needs no separate count
+			int found = this->dancing_links->solve(start_board, solution_board, solution_cnt ? 2 : 1);
+			this->dancing_links->setStats(nullptr);
+			if(solution_cnt && !this->stopped())
+				*solution_cnt = found;
+			return found > 0;
+		}
+		solution_board = start_board;
+		ConstraintPropagator::Trail trail;
+		return this->solve(solution_board, trail, stats, 0);
+	}
+
+	bool SudokuSolver::solve(MarkedBoard& board, ConstraintPropagator::Trail& trail, SolverStats& stats, int depth) const {
+		if(this->cancel && this->cancel->load(std::memory_order_relaxed))
+			return false; // the caller clears the cells it filled
+		if(this->budget && !this->budget->tick())
+			return false;
+		stats.nodes++;
+		if(depth > stats.max_depth)
+			stats.max_depth = depth;
+		int trail_size = trail.size;
+		if(!this->propagator.propagate(board, trail, stats.propagation)){
+			this->propagator.undo(board, trail, trail_size);
+			return false;
 		}
-		if(ri == BOARD_SIZE) return true;
-		std::bitset<BOARD_SIZE> taken = 
-			board.rowSets[ri] | board.colSets[ci] | board.blockSets[Board::getBlockNum(ri, ci)];
+		int ri, ci;
+		if(!board.findMostConstrainedCell(ri, ci)) return true;
+		std::bitset<BOARD_SIZE> candidates = board.getCandidates(ri, ci);
 		for(int k=0; k<BOARD_SIZE; k++){
-			if(taken.test(k))
+			if(!candidates.test(k))
 				continue;
-			board[ri][ci] = Constants::ALPHABET[k];
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = true;
-			if(this->solve(board, ri, ci))
+			board.placeValue(ri, ci, k);
+			if(this->solve(board, trail, stats, depth + 1))
 				return true;
-			board[ri][ci] = Constants::EMPTY_CELL;
-			board.rowSets[ri][k] = board.colSets[ci][k] = board.blockSets[Board::getBlockNum(ri, ci)][k] = false;
+			board.removeValue(ri, ci, k);
+			stats.backtracks++;
 		}
+		this->propagator.undo(board, trail, trail_size);
 		return false;
 	}
 }
\ No newline at end of file
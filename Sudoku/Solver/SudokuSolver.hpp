@@ -7,15 +7,88 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include "../Sudoku/Board.hpp"
 #include "../Sudoku/MarkedBoard.hpp"
+#include "../Sudoku/CanonicalForm.hpp"
+#include "BitboardSolver.hpp"
+#include "ConstraintPropagator.hpp"
+#include "DancingLinks.hpp"
+#include "SearchBudget.hpp"
+#include "SolutionCache.hpp"
+#include "SolverStats.hpp"
 
 namespace Sudoku {
+    /**
+     * @brief Search engines available to the SudokuSolver.
+     */
+    enum SolverEngine{
+        BACKTRACKING, /**< Naked and hidden singles propagation with backtracking over the MarkedBoard, branching on the most constrained cell. */
+        BITBOARD, /**< Backtracking over packed digit masks, see BitboardSolver. */
+        DANCING_LINKS /**< Exact cover search with Algorithm X, see DancingLinks. */
+    };
+
     /**
      * @brief Sudoku solver class that solves a given Sudoku puzzle.
+     * 
+     * @details A solver keeps the state of its engines between calls, so it is used by one thread at a time.
+     * Threads that solve concurrently use one solver each, only the SolutionCache may be shared between them.
      */
     class SudokuSolver {
     public:
+        /**
+         * @brief Default constructor. Constructs a SudokuSolver that uses the BACKTRACKING engine.
+         */
+        SudokuSolver();
+
+        /**
+         * @brief Constructor. Constructs a SudokuSolver that uses the given engine.
+         * @param engine The search engine used by solve.
+         */
+        SudokuSolver(SolverEngine engine);
+
+        /**
+         * @brief Sets the search engine used by solve.
+         * @param engine The new search engine.
+         */
+        void setEngine(SolverEngine engine);
+
+        /**
+         * @brief Getter for the search engine.
+         * @return The search engine used by solve.
+         */
+        SolverEngine getEngine() const;
+
+        /**
+         * @brief Sets a flag that cancels the searches of every engine.
+         * @details As soon as the flag is set, a running or later solve gives up and returns false as if no solution existed.
+         * The flag is only read, it is never reset by the solver.
+         * @param cancel Flag checked at every node of the search, or nullptr to never cancel.
+         */
+        void setCancelFlag(const std::atomic<bool>* cancel);
+
+        /**
+         * @brief Sets a budget that every node of the searches of every engine is counted against.
+         * @details Once the budget is exhausted, a running or later solve gives up and returns false as if no solution existed,
+         * so callers that need to tell the two apart check SearchBudget::exhausted afterwards.
+         * @param budget The budget, or nullptr for unbounded searches.
+         */
+        void setSearchBudget(SearchBudget* budget);
+
+        /**
+         * @brief Sets a cache that every solve looks the puzzle up in before searching.
+         * @details The puzzle is brought into its canonical form, see CanonicalForm. On a hit the cached solution is turned
+         * back into the orientation of the puzzle and no search runs. On a miss the search result is cached if the puzzle has
+         * no solution or is proven to have exactly one, so the answer never depends on which puzzle of an equivalence class
+         * was searched first. The DANCING_LINKS engine proves it by going on to a second solution in the same search. The other
+         * engines are followed by a dancing links count with a budget of UNIQUENESS_NODE_LIMIT nodes of its own, which is not
+         * added to the stats of the solve. Nothing is cached if the search was cancelled or ran out of budget, or if the count
+         * did not finish. Puzzles that have no canonical form are searched without the cache.
+         * @param cache The cache, or nullptr to always search. May be shared with the solvers of other threads.
+         */
+        void setSolutionCache(SolutionCache* cache);
+
         /**
          * @brief Solves the Sudoku puzzle starting from the given board and updates the solution_board.
          * 
@@ -27,16 +100,93 @@ namespace Sudoku {
          * 
          * @return True if the \p start_board has a solution, false otherwise.
          */
-        bool solve(const Board& start_board, MarkedBoard& solution_board) const;
+        bool solve(const Board& start_board, MarkedBoard& solution_board);
+
+        /**
+         * @brief Solves the Sudoku puzzle and reports how many cells were resolved by each propagation rule.
+         *
+         * @details Same as solve(const Board&, MarkedBoard&), but adds the number of cells filled by naked and hidden singles to \p counters.
+         * Cells filled on search paths that were later abandoned are counted as well. Only the BACKTRACKING engine propagates,
+         * the other engines leave \p counters unchanged.
+         *
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         * @param counters The counters to add the resolved cells to.
+         *
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool solve(const Board& start_board, MarkedBoard& solution_board, PropagationCounters& counters);
+
+        /**
+         * @brief Solves the Sudoku puzzle and adds the work it took to \p stats.
+         *
+         * @details Same as solve(const Board&, MarkedBoard&), but measures the search of the selected engine: the nodes,
+         * backtracks, depth and propagations counted by the engine and the wall time of the call. The stats of this solve
+         * are added to \p stats, so a fresh SolverStats gives the stats of a single call and a reused one adds up many calls.
+         *
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         * @param stats The stats this solve is added to.
+         *
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool solve(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats);
 
     private:
+        SolverEngine engine; /**< Search engine used by solve. */
+        BitboardSolver bitboard_solver; /**< Engine used when engine is BITBOARD. */
+        std::unique_ptr<DancingLinks> dancing_links; /**< Engine used when engine is DANCING_LINKS. Allocated on first use, the matrix is restored after every search. */
+
+        ConstraintPropagator propagator; /**< Singles propagation applied at every node of the BACKTRACKING search. */
+        const std::atomic<bool>* cancel; /**< Flag that cancels the search when set, or nullptr. */
+        SearchBudget* budget; /**< Budget that stops the search when exhausted, or nullptr. */
+        SolutionCache* cache; /**< Cache of solved puzzles, or nullptr. */
+        static const uint64_t UNIQUENESS_NODE_LIMIT = 100000; /**< Nodes of the count that proves a solved puzzle unique before it is cached. */
+        std::unique_ptr<CanonicalForm> canonical_form; /**< Canonical form of the puzzles looked up in the cache. Allocated on first use. */
+
+        /**
+         * @brief Looks the puzzle up in the cache and only runs the engine on a miss.
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         * @param stats The stats the engine counts its search in, or the hit in. The time is left to the caller.
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool solveCached(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats);
+
+        /**
+         * @brief Counts the solutions of a solved puzzle with dancing links, stopping at the second one.
+         * @param start_board The puzzle.
+         * @return True if the puzzle has exactly one solution, false if it has more or the count was cancelled or ran out of nodes.
+         */
+        bool provesUnique(const Board& start_board);
+
+        /**
+         * @brief Checks if the last search was cancelled or ran out of budget.
+         * @return True if the cancel flag is set or the budget is exhausted.
+         */
+        bool stopped() const;
+
+        /**
+         * @brief Solves the puzzle with the selected engine.
+         * @param start_board The initial Sudoku board.
+         * @param solution_board The Sudoku board to store the solution.
+         * @param stats The stats the engine counts its search in. The time is left to the caller.
+         * @param solution_cnt If not nullptr, the dancing links engine goes on to a second solution and stores how many it
+         * found, 1 or 2. It is left unchanged by the other engines and by a search that was stopped.
+         * @return True if the \p start_board has a solution, false otherwise.
+         */
+        bool runEngine(const Board& start_board, MarkedBoard& solution_board, SolverStats& stats, int* solution_cnt = nullptr);
+
         /**
          * @brief Recursively solves the Sudoku puzzle using backtracking.
+         * @details Fills the forced cells first and then branches on the most constrained empty cell of the \p board.
+         * On failure every cell filled by this call is cleared again.
          * @param board The current state of the Sudoku board.
-         * @param rowIdx The current row index being processed.
-         * @param colIdx The current column index being processed.
+         * @param trail The trail of the cells filled by propagation.
+         * @param stats The stats of the search, propagation counters included.
+         * @param depth The number of values guessed on the path to this node.
          * @return True if the puzzle is successfully solved, false otherwise.
          */
-        bool solve(MarkedBoard& board, int rowIdx, int colIdx) const;
+        bool solve(MarkedBoard& board, ConstraintPropagator::Trail& trail, SolverStats& stats, int depth) const;
     };
 }
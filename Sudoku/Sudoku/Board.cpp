@@ -7,19 +7,17 @@
 
 #include <iostream>
 #include <string>
-#include <sstream>
 #include "Board.hpp"
 #include "../Constants.hpp"
 
-using Constants::BOARD_SIZE;
-using Constants::BLOCK_SIZE;
-
 namespace Sudoku {
-	Board::Board(): board() {}
+	template<int BlockSize>
+	BasicBoard<BlockSize>::BasicBoard(): board() {}
 
-	Board::Board(const char board[BOARD_SIZE][BOARD_SIZE]) {
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+	template<int BlockSize>
+	BasicBoard<BlockSize>::BasicBoard(const char board[SIZE][SIZE]) {
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				if(board[i][j] == ' ')
 					this->board[i][j] = Constants::EMPTY_CELL;
 				else
@@ -28,58 +26,64 @@ namespace Sudoku {
 		}
 	}
 
-	Board::Board(const Board& other): board() {
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+	template<int BlockSize>
+	BasicBoard<BlockSize>::BasicBoard(const BasicBoard& other): board() {
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				this->board[i][j] = other[i][j];
 			}
 		}
 	}
 
-	Board& Board::operator=(const Board& other){
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+	template<int BlockSize>
+	BasicBoard<BlockSize>& BasicBoard<BlockSize>::operator=(const BasicBoard& other){
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				this->board[i][j] = other[i][j];
 			}
 		}
 		return *this;
 	}
 
-	char* Board::operator[](int rowIdx){
+	template<int BlockSize>
+	char* BasicBoard<BlockSize>::operator[](int rowIdx){
 		return this->board[rowIdx];
 	}
 
-	const char* Board::operator[](int rowIdx) const {
+	template<int BlockSize>
+	const char* BasicBoard<BlockSize>::operator[](int rowIdx) const {
 		return this->board[rowIdx];
 	}
 
-	std::istream& operator>>(std::istream& in, Board& board){
+	template<int BlockSize>
+	std::istream& operator>>(std::istream& in, BasicBoard<BlockSize>& board){
+		const int size = BasicBoard<BlockSize>::SIZE;
 		std::string str;
 		std::getline(in, str); // first line (delimiters only)
-		for(int i=0; i<BOARD_SIZE; i++){
+		for(int i=0; i<size; i++){
 			std::getline(in, str);
-			std::stringstream ss(str);
-			ss.ignore(2); // delimiter
-			for(int j=0; j<BOARD_SIZE; j++){
-				char ch;
-				ss.get(ch);
+			// every cell is "| x ", the value is the third character
+			for(int j=0; j<size; j++){
+				size_t pos = 4*j + 2;
+				char ch = pos < str.size() ? str[pos] : ' ';
 				if(ch == ' ')
 					board[i][j] = Constants::EMPTY_CELL;
 				else
 					board[i][j] = ch;
-				ss.ignore(3); // delimiter
 			}
 			std::getline(in, str); // delimiter line
 		}
 		return in;
 	}
 
-	std::ostream& operator<<(std::ostream& out, const Board& board){
-		for(int j=0; j<BOARD_SIZE; j++)
+	template<int BlockSize>
+	std::ostream& operator<<(std::ostream& out, const BasicBoard<BlockSize>& board){
+		const int size = BasicBoard<BlockSize>::SIZE;
+		for(int j=0; j<size; j++)
 			out << " ---";
 		out << " \n";
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+		for(int i=0; i<size; i++){
+			for(int j=0; j<size; j++){
 				if(board[i][j] == Constants::EMPTY_CELL)
 					out << "|   ";
 				else
@@ -87,14 +91,31 @@ namespace Sudoku {
 			}
 			out << "|\n";
 			// delimiter row
-			for(int j=0; j<BOARD_SIZE; j++)
+			for(int j=0; j<size; j++)
 				out << " ---";
 			out << " \n";
 		}
 		return out;
 	}
 
-	int Board::getBlockNum(int rowIdx, int colIdx) {
-		return (rowIdx/BLOCK_SIZE)*BLOCK_SIZE + colIdx/BLOCK_SIZE;
+	template<int BlockSize>
+	int BasicBoard<BlockSize>::getBlockNum(int rowIdx, int colIdx) {
+		return (rowIdx/BlockSize)*BlockSize + colIdx/BlockSize;
 	}
+
+	// every supported size is compiled here, so the members stay out of the header
+	template class BasicBoard<2>;
+	template class BasicBoard<3>;
+	template class BasicBoard<4>;
+	template class BasicBoard<5>;
+
+	template std::istream& operator>>(std::istream& in, BasicBoard<2>& board);
+	template std::istream& operator>>(std::istream& in, BasicBoard<3>& board);
+	template std::istream& operator>>(std::istream& in, BasicBoard<4>& board);
+	template std::istream& operator>>(std::istream& in, BasicBoard<5>& board);
+
+	template std::ostream& operator<<(std::ostream& out, const BasicBoard<2>& board);
+	template std::ostream& operator<<(std::ostream& out, const BasicBoard<3>& board);
+	template std::ostream& operator<<(std::ostream& out, const BasicBoard<4>& board);
+	template std::ostream& operator<<(std::ostream& out, const BasicBoard<5>& board);
 }
\ No newline at end of file
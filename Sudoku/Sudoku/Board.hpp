@@ -10,38 +10,49 @@
 #include <iostream>
 #include <bitset>
 #include "../Constants.hpp"
+#include "BoardTraits.hpp"
 
 using Constants::BOARD_SIZE;
 
 namespace Sudoku {
     /**
-     * @brief Class that represents a Sudoku board state.
+     * @brief Class that represents a Sudoku board state of any supported size.
+     *
+     * @details The size is a template parameter, see BoardTraits. The members are defined in Board.cpp and
+     * instantiated there for the 4x4, 9x9, 16x16 and 25x25 boards.
+     *
+     * @tparam BlockSize Number of rows and columns of a block.
      */
-    class Board {
+    template<int BlockSize>
+    class BasicBoard {
     public:
+        typedef BoardTraits<BlockSize> Traits; /**< Dimensions and alphabet of the board. */
+
+        static const int SIZE = Traits::BOARD_SIZE; /**< Number of rows and columns. */
+
         /**
          * @brief Default constructor. Creates an empty Sudoku board.
          */
-        Board();
+        BasicBoard();
 
         /**
          * @brief Constructor. Creates a Sudoku board from the given char matrix.
          * @param board The 2D char array to create the Sudoku board from.
          */
-        Board(const char board[BOARD_SIZE][BOARD_SIZE]);
+        BasicBoard(const char board[SIZE][SIZE]);
 
         /**
          * @brief Copy constructor. Performs a deep copy of the Sudoku board.
          * @param other The Sudoku board to copy.
          */
-        Board(const Board& other);
+        BasicBoard(const BasicBoard& other);
 
         /**
          * @brief Assignment operator. Constructs the Sudoku board with the copy of the contents of another board.
          * @param other The Sudoku board to copy.
          * @return A reference to the modified Sudoku board.
          */
-        Board& operator=(const Board& other);
+        BasicBoard& operator=(const BasicBoard& other);
 
         /**
          * @brief Overloaded indexing operator for non-constant objects. Provides access to the specified row of the Sudoku board.
@@ -57,22 +68,6 @@ namespace Sudoku {
          */
         const char* operator[](int rowIdx) const;
 
-        /**
-         * @brief Input stream operator. Reads a Sudoku board from the input stream.
-         * @param in The input stream.
-         * @param board The Sudoku board to read into.
-         * @return A reference to the input stream after reading the Sudoku board.
-         */
-        friend std::istream& operator>>(std::istream& in, Board& board);
-
-        /**
-         * @brief Output stream operator. Writes a Sudoku board to the output stream.
-         * @param out The output stream.
-         * @param board The Sudoku board to write.
-         * @return A reference to the output stream after writing the Sudoku board.
-         */
-        friend std::ostream& operator<<(std::ostream& out, const Board& board);
-
         /**
          * @brief Static method to get the block number based on row and column indices.
          * @param rowIdx The index of the row.
@@ -82,6 +77,29 @@ namespace Sudoku {
         static int getBlockNum(int rowIdx, int colIdx);
 
     private:
-        char board[BOARD_SIZE][BOARD_SIZE]; /**< 2D array representing the Sudoku board. */
+        char board[SIZE][SIZE]; /**< 2D array representing the Sudoku board. */
     };
+
+    /**
+     * @brief The classic 9x9 board used by the game, the solver, the generator and the file formats.
+     */
+    typedef BasicBoard<Constants::BLOCK_SIZE> Board;
+
+    /**
+     * @brief Input stream operator. Reads a Sudoku board from the input stream.
+     * @param in The input stream.
+     * @param board The Sudoku board to read into.
+     * @return A reference to the input stream after reading the Sudoku board.
+     */
+    template<int BlockSize>
+    std::istream& operator>>(std::istream& in, BasicBoard<BlockSize>& board);
+
+    /**
+     * @brief Output stream operator. Writes a Sudoku board to the output stream.
+     * @param out The output stream.
+     * @param board The Sudoku board to write.
+     * @return A reference to the output stream after writing the Sudoku board.
+     */
+    template<int BlockSize>
+    std::ostream& operator<<(std::ostream& out, const BasicBoard<BlockSize>& board);
 }
@@ -0,0 +1,75 @@
+/**
+* @file BoardBatch.cpp
+* @brief Implements members of the BoardBatch class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include "BoardBatch.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+	BoardBatch::BoardBatch() : count(0), stride(0) {}
+
+	size_t BoardBatch::size() const {
+		return this->count;
+	}
+
+	size_t BoardBatch::getStride() const {
+		return this->stride;
+	}
+
+	void BoardBatch::reserve(size_t capacity){
+		if(capacity <= this->stride)
+			return;
+		size_t stride = (capacity + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+		// the cell arrays move apart, so the boards are copied to a new layout
+		std::vector<char> cells(CELL_COUNT * stride, Constants::EMPTY_CELL);
+		for(int k=0; k<CELL_COUNT && this->count>0; k++)
+			std::copy(this->getCell(k), this->getCell(k) + this->count, cells.begin() + k*stride);
+		this->cells.swap(cells);
+		this->stride = stride;
+	}
+
+	void BoardBatch::resize(size_t count){
+		if(count > this->stride)
+			this->reserve(std::max(count, 2*this->stride));
+		// the padding is kept empty, so growing only moves the end
+		for(int k=0; k<CELL_COUNT && count<this->count; k++)
+			std::fill(this->getCell(k) + count, this->getCell(k) + this->count, Constants::EMPTY_CELL);
+		this->count = count;
+	}
+
+	void BoardBatch::clear(){
+		this->resize(0);
+	}
+
+	void BoardBatch::addBoard(const Board& board){
+		this->resize(this->count + 1);
+		this->setBoard(this->count - 1, board);
+	}
+
+	void BoardBatch::setBoard(size_t index, const Board& board){
+		if(index >= this->count)
+			throw std::out_of_range("Board index out of range.");
+		for(int k=0; k<CELL_COUNT; k++)
+			this->cells[k*this->stride + index] = board[k / BOARD_SIZE][k % BOARD_SIZE];
+	}
+
+	void BoardBatch::getBoard(size_t index, Board& board) const {
+		if(index >= this->count)
+			throw std::out_of_range("Board index out of range.");
+		for(int k=0; k<CELL_COUNT; k++)
+			board[k / BOARD_SIZE][k % BOARD_SIZE] = this->cells[k*this->stride + index];
+	}
+
+	char* BoardBatch::getCell(int cell){
+		return this->cells.data() + cell*this->stride;
+	}
+
+	const char* BoardBatch::getCell(int cell) const {
+		return this->cells.data() + cell*this->stride;
+	}
+}
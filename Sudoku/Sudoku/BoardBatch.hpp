@@ -0,0 +1,103 @@
+/**
+* @file BoardBatch.hpp
+* @brief Defines the BoardBatch class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Board.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Structure of arrays container of boards: cell k of every board is stored contiguously.
+     *
+     * @details The boards are laid out by cell, so a kernel working on cell k reads the cell of many boards with a
+     * single load. Every cell array is padded to a multiple of LANE_COUNT boards with empty boards, so kernels can
+     * always load whole vectors.
+     */
+    class BoardBatch {
+    public:
+        static const size_t LANE_COUNT = 32; /**< Boards are padded to a multiple of this count. */
+        static const int CELL_COUNT = BOARD_SIZE * BOARD_SIZE; /**< Number of cells of a board. */
+
+        /**
+         * @brief Default constructor. Creates an empty batch.
+         */
+        BoardBatch();
+
+        /**
+         * @brief Returns the number of boards in the batch.
+         * @return The number of boards.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns the distance between the same board of two consecutive cell arrays.
+         * @return The number of boards the cell arrays are padded to, a multiple of LANE_COUNT.
+         */
+        size_t getStride() const;
+
+        /**
+         * @brief Reserves space for at least \p capacity boards.
+         * @param capacity The number of boards.
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Resizes the batch. Added boards are empty.
+         * @param count The new number of boards.
+         */
+        void resize(size_t count);
+
+        /**
+         * @brief Removes every board.
+         */
+        void clear();
+
+        /**
+         * @brief Appends a board to the batch.
+         * @param board The board to append.
+         */
+        void addBoard(const Board& board);
+
+        /**
+         * @brief Overwrites a board of the batch.
+         * @param index The index of the board.
+         * @param board The board to copy.
+         * @throw std::out_of_range if \p index is not less than size()
+         */
+        void setBoard(size_t index, const Board& board);
+
+        /**
+         * @brief Copies a board out of the batch.
+         * @param index The index of the board.
+         * @param board The board to write to.
+         * @throw std::out_of_range if \p index is not less than size()
+         */
+        void getBoard(size_t index, Board& board) const;
+
+        /**
+         * @brief Provides access to a cell of every board.
+         * @param cell The index of the cell, rowIdx*BOARD_SIZE + colIdx.
+         * @return Pointer to getStride() characters, the cell of every board followed by the padding.
+         */
+        char* getCell(int cell);
+
+        /**
+         * @brief Provides read-only access to a cell of every board.
+         * @param cell The index of the cell, rowIdx*BOARD_SIZE + colIdx.
+         * @return Pointer to getStride() characters, the cell of every board followed by the padding.
+         */
+        const char* getCell(int cell) const;
+
+    private:
+        std::vector<char> cells; /**< CELL_COUNT arrays of stride characters. */
+        size_t count; /**< Number of boards. */
+        size_t stride; /**< Padded number of boards of every cell array. */
+    };
+}
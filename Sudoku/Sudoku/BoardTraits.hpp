@@ -0,0 +1,66 @@
+/**
+* @file BoardTraits.hpp
+* @brief Defines the compile-time dimensions of the boards of every supported size.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Dimensions, alphabet and mask type of a board made of \p BlockSize x \p BlockSize blocks.
+     *
+     * @details Everything is a compile-time constant, so code templated on the block size gets fully specialized loop
+     * bounds and the narrowest mask that holds a bit per value. The 9x9 boards (block size Constants::BLOCK_SIZE)
+     * use the digits of Constants::ALPHABET, bigger boards continue with the letters: 16x16 boards use 1-9 and A-G,
+     * 25x25 boards 1-9 and A-P.
+     *
+     * @tparam BlockSize Number of rows and columns of a block, from 2 (4x4 boards) to 5 (25x25 boards).
+     */
+    template<int BlockSize>
+    struct BoardTraits {
+        static_assert(BlockSize >= 2 && BlockSize <= 5, "Supported boards are 4x4, 9x9, 16x16 and 25x25.");
+
+        static const int BLOCK_SIZE = BlockSize; /**< Number of rows and columns of a block. */
+        static const int BOARD_SIZE = BlockSize * BlockSize; /**< Number of rows, columns, blocks and values. */
+        static const int CELL_COUNT = BOARD_SIZE * BOARD_SIZE; /**< Number of cells on the board. */
+
+        /**
+         * @brief Value mask of a unit or a cell. Bit k is set if the k-th character of the alphabet is present.
+         */
+        typedef typename std::conditional<BOARD_SIZE <= 16, uint16_t, uint32_t>::type Mask;
+
+        /**
+         * @brief Index of a cell, wide enough for CELL_COUNT.
+         */
+        typedef typename std::conditional<CELL_COUNT <= 256, uint8_t, uint16_t>::type CellIndex;
+
+        /**
+         * @brief Gets the character of a value.
+         * @param k The index of the value, less than BOARD_SIZE.
+         * @return The k-th character of the alphabet.
+         */
+        static char symbol(int k){
+            return "123456789ABCDEFGHIJKLMNOP"[k];
+        }
+
+        /**
+         * @brief Gets the value of a character.
+         * @param ch The character.
+         * @return The index of \p ch in the alphabet, or -1 if it is not a value of this board size.
+         */
+        static int index(char ch){
+            int k = -1;
+            if(ch >= '1' && ch <= '9')
+                k = ch - '1';
+            else if(ch >= 'A' && ch <= 'P')
+                k = 9 + (ch - 'A');
+            return k < BOARD_SIZE ? k : -1;
+        }
+    };
+}
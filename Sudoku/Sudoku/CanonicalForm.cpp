@@ -0,0 +1,251 @@
+/**
+* @file CanonicalForm.cpp
+* @brief Implements the BoardTransform and the CanonicalForm.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <algorithm>
+#include <cstring>
+#include "CanonicalForm.hpp"
+#include "../Constants.hpp"
+
+using Constants::BLOCK_SIZE;
+
+namespace Sudoku {
+	void BoardTransform::apply(const Board& board, Board& result) const {
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				char ch = this->transposed ? board[this->cols[j]][this->rows[i]] : board[this->rows[i]][this->cols[j]];
+				int k = Constants::keyIndex(ch);
+				result[i][j] = k < 0 ? Constants::EMPTY_CELL : Constants::ALPHABET[this->values[k]];
+			}
+		}
+	}
+
+	void BoardTransform::revert(const Board& board, Board& result) const {
+		uint8_t inverse[BOARD_SIZE];
+		for(int k=0; k<BOARD_SIZE; k++)
+			inverse[this->values[k]] = static_cast<uint8_t>(k);
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				int k = Constants::keyIndex(board[i][j]);
+				char ch = k < 0 ? Constants::EMPTY_CELL : Constants::ALPHABET[inverse[k]];
+				if(this->transposed)
+					result[this->cols[j]][this->rows[i]] = ch;
+				else
+					result[this->rows[i]][this->cols[j]] = ch;
+			}
+		}
+	}
+
+	bool CanonicalForm::canonicalize(const Board& board, Board& canonical, BoardTransform& transform){
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				uint8_t value = 0;
+				if(board[i][j] != Constants::EMPTY_CELL){
+					int k = Constants::keyIndex(board[i][j]);
+					if(k < 0)
+						return false;
+					value = static_cast<uint8_t>(k + 1);
+				}
+				this->cells[0][i][j] = value;
+				this->cells[1][j][i] = value;
+			}
+		}
+
+		// nothing is placed yet, so every column and stack of both orientations is open
+		this->candidates.clear();
+		for(int t=0; t<2; t++){
+			Candidate candidate;
+			candidate.transposed = static_cast<uint8_t>(t);
+			candidate.free_stacks = BLOCK_SIZE;
+			for(int s=0; s<BLOCK_SIZE; s++)
+				candidate.free_cols[s] = BLOCK_SIZE;
+			for(int j=0; j<BOARD_SIZE; j++)
+				candidate.cols[j] = static_cast<uint8_t>(j);
+			std::memset(candidate.labels, 0, sizeof(candidate.labels));
+			candidate.label_cnt = 0;
+			this->candidates.push_back(candidate);
+		}
+		for(int position=0; position<BOARD_SIZE; position++){
+			if(!this->addRow(position))
+				return false;
+		}
+
+		// every remaining candidate gives the same board, values that never appear take the last labels
+		const Candidate& candidate = this->candidates[0];
+		transform.transposed = candidate.transposed != 0;
+		std::memcpy(transform.rows, candidate.rows, sizeof(transform.rows));
+		std::memcpy(transform.cols, candidate.cols, sizeof(transform.cols));
+		int label_cnt = candidate.label_cnt;
+		for(int value=1; value<=BOARD_SIZE; value++){
+			int label = candidate.labels[value] ? candidate.labels[value] : ++label_cnt;
+			transform.values[value - 1] = static_cast<uint8_t>(label - 1);
+		}
+		transform.apply(board, canonical);
+		return true;
+	}
+
+	bool CanonicalForm::addRow(int position){
+		int band_start = position - position % BLOCK_SIZE;
+		uint8_t best[BOARD_SIZE];
+		bool found = false;
+		// the tie count of the finished row decides, a smaller row found later can still drop the overflowing ties
+		bool overflow = false;
+		this->next.clear();
+		for(const Candidate& candidate : this->candidates){
+			// the next row comes from the current band, or starts one of the unused bands
+			bool allowed[BOARD_SIZE];
+			if(position == band_start){
+				for(int r=0; r<BOARD_SIZE; r++)
+					allowed[r] = true;
+				for(int p=0; p<position; p+=BLOCK_SIZE){
+					int band = candidate.rows[p] / BLOCK_SIZE;
+					for(int r=0; r<BLOCK_SIZE; r++)
+						allowed[band*BLOCK_SIZE + r] = false;
+				}
+			} else {
+				for(int r=0; r<BOARD_SIZE; r++)
+					allowed[r] = r / BLOCK_SIZE == candidate.rows[band_start] / BLOCK_SIZE;
+				for(int p=band_start; p<position; p++)
+					allowed[candidate.rows[p]] = false;
+			}
+			for(int row=0; row<BOARD_SIZE; row++){
+				if(allowed[row])
+					this->extend(candidate, row, position, best, found, overflow);
+			}
+		}
+		this->candidates.swap(this->next);
+		return !overflow;
+	}
+
+	void CanonicalForm::extend(const Candidate& candidate, int row, int position, uint8_t* best, bool& found, bool& overflow){
+		const uint8_t* line = this->cells[candidate.transposed][row];
+		StackOrder orders[BLOCK_SIZE];
+		for(int s=0; s<BLOCK_SIZE; s++)
+			orderStack(candidate, line, s, s < candidate.free_stacks ? BLOCK_SIZE : candidate.free_cols[s], orders[s]);
+
+		// the open stacks are sorted by their part of the row, the ones that stay empty first
+		int stacks[BLOCK_SIZE];
+		for(int s=0; s<BLOCK_SIZE; s++)
+			stacks[s] = s;
+		for(int a=1; a<candidate.free_stacks; a++){
+			for(int b=a; b>0 && std::memcmp(orders[stacks[b]].key, orders[stacks[b - 1]].key, BLOCK_SIZE) < 0; b--)
+				std::swap(stacks[b], stacks[b - 1]);
+		}
+
+		uint8_t labels[BOARD_SIZE + 1];
+		std::memcpy(labels, candidate.labels, sizeof(labels));
+		uint8_t label_cnt = candidate.label_cnt;
+		uint8_t result[BOARD_SIZE];
+		for(int j=0; j<BOARD_SIZE; j++){
+			uint8_t value = line[orders[stacks[j / BLOCK_SIZE]].cols[j % BLOCK_SIZE]];
+			if(value && !labels[value])
+				labels[value] = ++label_cnt;
+			result[j] = value ? labels[value] : 0;
+		}
+		int cmp = found ? std::memcmp(result, best, BOARD_SIZE) : -1;
+		if(cmp > 0)
+			return;
+		if(cmp < 0){
+			std::memcpy(best, result, BOARD_SIZE);
+			found = true;
+			overflow = false;
+			this->next.clear();
+		}
+		if(overflow)
+			return;
+
+		// open stacks that stay empty stay open, open stacks with the same part of the row can come in any order
+		int open_stacks = 0;
+		while(open_stacks < candidate.free_stacks && orders[stacks[open_stacks]].key[BLOCK_SIZE - 1] == 0)
+			open_stacks++;
+		int group_start = open_stacks, group_len = 1;
+		for(int s=open_stacks; s<candidate.free_stacks; s++){
+			int len = 1;
+			while(s + len < candidate.free_stacks && std::memcmp(orders[stacks[s]].key, orders[stacks[s + len]].key, BLOCK_SIZE) == 0)
+				len++;
+			if(len > group_len){
+				group_start = s;
+				group_len = len;
+			}
+		}
+
+		// every order of the tying stacks and of the new values of every stack gives the same row, but other labels
+		uint8_t group[BLOCK_SIZE] = {0, 1, 2};
+		do {
+			int order[BLOCK_SIZE];
+			for(int s=0; s<BLOCK_SIZE; s++)
+				order[s] = stacks[s];
+			for(int k=0; k<group_len; k++)
+				order[group_start + k] = stacks[group_start + group[k]];
+			uint8_t fresh[BLOCK_SIZE][BLOCK_SIZE] = {{0, 1, 2}, {0, 1, 2}, {0, 1, 2}};
+			while(true){
+				if(this->next.size() == MAX_CANDIDATES){
+					overflow = true;
+					return;
+				}
+				this->next.push_back(candidate);
+				Candidate& extended = this->next.back();
+				extended.rows[position] = static_cast<uint8_t>(row);
+				extended.free_stacks = static_cast<uint8_t>(open_stacks);
+				for(int s=0; s<BLOCK_SIZE; s++){
+					const StackOrder& stack = orders[order[s]];
+					extended.free_cols[s] = stack.empty_cnt;
+					for(int c=0; c<BLOCK_SIZE; c++){
+						int k = c - stack.new_start;
+						extended.cols[s*BLOCK_SIZE + c] = k >= 0 && k < stack.new_cnt ? stack.cols[stack.new_start + fresh[s][k]] : stack.cols[c];
+					}
+				}
+				for(int j=0; j<BOARD_SIZE; j++){
+					uint8_t value = line[extended.cols[j]];
+					if(value && !extended.labels[value])
+						extended.labels[value] = ++extended.label_cnt;
+				}
+
+				int s = BLOCK_SIZE - 1;
+				while(s >= 0 && !std::next_permutation(fresh[s], fresh[s] + orders[order[s]].new_cnt))
+					s--;
+				if(s < 0)
+					break;
+			}
+		} while(std::next_permutation(group, group + group_len));
+	}
+
+	void CanonicalForm::orderStack(const Candidate& candidate, const uint8_t* line, int stack, int open, StackOrder& order){
+		const uint8_t* cols = candidate.cols + stack*BLOCK_SIZE;
+		uint8_t empty[BLOCK_SIZE], labeled[BLOCK_SIZE], fresh[BLOCK_SIZE];
+		int empty_cnt = 0, labeled_cnt = 0, fresh_cnt = 0;
+		for(int c=0; c<open; c++){
+			uint8_t value = line[cols[c]];
+			if(!value)
+				empty[empty_cnt++] = cols[c];
+			else if(candidate.labels[value])
+				labeled[labeled_cnt++] = cols[c];
+			else
+				fresh[fresh_cnt++] = cols[c];
+		}
+		// labeled values in ascending order, values without a label get larger labels than all of them
+		for(int a=1; a<labeled_cnt; a++){
+			for(int b=a; b>0 && candidate.labels[line[labeled[b]]] < candidate.labels[line[labeled[b - 1]]]; b--)
+				std::swap(labeled[b], labeled[b - 1]);
+		}
+		int c = 0;
+		for(int k=0; k<empty_cnt; k++)
+			order.cols[c++] = empty[k];
+		for(int k=0; k<labeled_cnt; k++)
+			order.cols[c++] = labeled[k];
+		for(int k=0; k<fresh_cnt; k++)
+			order.cols[c++] = fresh[k];
+		for(int k=open; k<BLOCK_SIZE; k++)
+			order.cols[c++] = cols[k];
+		order.empty_cnt = static_cast<uint8_t>(empty_cnt);
+		order.new_start = static_cast<uint8_t>(empty_cnt + labeled_cnt);
+		order.new_cnt = static_cast<uint8_t>(fresh_cnt);
+		for(int k=0; k<BLOCK_SIZE; k++){
+			uint8_t value = line[order.cols[k]];
+			order.key[k] = !value ? 0 : candidate.labels[value] ? candidate.labels[value] : 255;
+		}
+	}
+}
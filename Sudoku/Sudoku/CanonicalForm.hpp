@@ -0,0 +1,134 @@
+/**
+* @file CanonicalForm.hpp
+* @brief Defines the BoardTransform structure and the CanonicalForm class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief A symmetry of the Sudoku rules: a transposition, a permutation of the rows and of the columns that keeps
+     * the bands and stacks together, and a relabeling of the values.
+     *
+     * @details Every transform maps puzzles to puzzles with the same number of solutions and solutions to solutions.
+     */
+    struct BoardTransform {
+        bool transposed = false; /**< Whether the board is transposed before the rows and columns are permuted. */
+        uint8_t rows[BOARD_SIZE] = {}; /**< Row i of the result is row rows[i] of the, possibly transposed, board. */
+        uint8_t cols[BOARD_SIZE] = {}; /**< Column j of the result is column cols[j] of the, possibly transposed, board. */
+        uint8_t values[BOARD_SIZE] = {}; /**< Value ALPHABET[k] of the board becomes ALPHABET[values[k]] in the result. */
+
+        /**
+         * @brief Applies the transform.
+         * @param board The board. Cells outside of the alphabet are copied as empty cells.
+         * @param result Set to the transformed board, must not be \p board itself.
+         */
+        void apply(const Board& board, Board& result) const;
+
+        /**
+         * @brief Applies the inverse of the transform, apply followed by revert gives back the board.
+         * @param board The transformed board.
+         * @param result Set to the board \p board was transformed from, must not be \p board itself.
+         */
+        void revert(const Board& board, Board& result) const;
+    };
+
+    /**
+     * @brief Computes the canonical form of boards: the same board for every board that one BoardTransform turns into another.
+     *
+     * @details The canonical form is the minlex form: of all the transforms of the board, the one whose cells, read row by
+     * row with empty cells before every value, come first in lexicographic order. The values are relabeled in the order
+     * they first appear, so only the transposition and the row and column orders are searched.
+     *
+     * The search builds the canonical board one row at a time and keeps every partial transform that ties for the smallest
+     * rows so far. Columns and stacks that are still empty in every placed row are kept in any order until a row decides
+     * them, so sparse rows do not multiply the ties. Full grids keep too many ties, every order of the columns gives the
+     * same first row: once more than MAX_CANDIDATES partial transforms tie, canonicalize gives up. Equivalent boards tie
+     * the same way, so either all of them get a canonical form or none does.
+     *
+     * The candidate vectors are reused between calls, so an instance is not safe to use from several threads at the same time.
+     */
+    class CanonicalForm {
+    public:
+        static const size_t MAX_CANDIDATES = 4096; /**< Maximum number of tying partial transforms before canonicalize gives up. */
+
+        /**
+         * @brief Computes the canonical form of a board.
+         * @param board The board. Every cell must be empty or in the alphabet.
+         * @param canonical Set to the canonical form of \p board, must not be \p board itself.
+         * @param transform Set to a transform that turns \p board into \p canonical.
+         * @return False if the board has a cell outside of the alphabet or too many ties, \p canonical and \p transform are
+         * then left unspecified.
+         */
+        bool canonicalize(const Board& board, Board& canonical, BoardTransform& transform);
+
+    private:
+        /**
+         * @brief A partial transform that ties for the smallest rows so far.
+         *
+         * @details Columns that are empty in every row placed so far can still be swapped without changing those rows, so
+         * their order is left open: they are the first free_cols columns of their stack, and stacks without any given so far
+         * are the first free_stacks stacks. The next row that has a given in them decides their order.
+         */
+        struct Candidate {
+            uint8_t transposed; /**< 1 if the board is transposed. */
+            uint8_t free_stacks; /**< Number of leading stacks that are empty in every row placed so far. */
+            uint8_t free_cols[Constants::BLOCK_SIZE]; /**< Number of leading columns of every stack that are empty in every row placed so far. */
+            uint8_t rows[BOARD_SIZE]; /**< The rows placed so far. */
+            uint8_t cols[BOARD_SIZE]; /**< The column order, stack after stack. */
+            uint8_t labels[BOARD_SIZE + 1]; /**< Label of every value of the cells, 0 for values that did not appear yet. */
+            uint8_t label_cnt; /**< Number of values labeled so far. */
+        };
+
+        /**
+         * @brief The smallest arrangement of the open columns of one stack for the next row.
+         */
+        struct StackOrder {
+            uint8_t cols[Constants::BLOCK_SIZE]; /**< Empty open columns first, then the labeled values in ascending order, then the new values, then the decided columns. */
+            uint8_t key[Constants::BLOCK_SIZE]; /**< The row inside the stack, 0 for an empty cell and 255 for a value without a label yet. */
+            uint8_t empty_cnt; /**< Open columns that stay open. */
+            uint8_t new_start; /**< First column of the new values. */
+            uint8_t new_cnt; /**< Number of new values, any order of them gives the same row. */
+        };
+
+        uint8_t cells[2][BOARD_SIZE][BOARD_SIZE]; /**< The board and its transposition, 0 for an empty cell, value index + 1 otherwise. */
+        std::vector<Candidate> candidates; /**< Partial transforms of the rows placed so far. */
+        std::vector<Candidate> next; /**< Partial transforms with one more row. */
+
+        /**
+         * @brief Places the next row of every candidate, keeping the extensions that tie for the smallest row.
+         * @param position The index of the row in the canonical board.
+         * @return False if the candidates exceed MAX_CANDIDATES.
+         */
+        bool addRow(int position);
+
+        /**
+         * @brief Adds every arrangement of the open columns and stacks that gives a row its smallest form to the next candidates.
+         * @param candidate The candidate.
+         * @param row The row placed next.
+         * @param position The index of the row in the canonical board.
+         * @param best The smallest row found so far, updated if the row is smaller.
+         * @param found Whether \p best holds a row, set to true.
+         * @param overflow Set to true if the ties of \p best exceed MAX_CANDIDATES, reset if the row is smaller.
+         */
+        void extend(const Candidate& candidate, int row, int position, uint8_t* best, bool& found, bool& overflow);
+
+        /**
+         * @brief Arranges the open columns of a stack for the next row.
+         * @param candidate The candidate.
+         * @param line The next row.
+         * @param stack The position of the stack in the column order.
+         * @param open The number of open columns of the stack.
+         * @param order Set to the arrangement.
+         */
+        static void orderStack(const Candidate& candidate, const uint8_t* line, int stack, int open, StackOrder& order);
+    };
+}
@@ -0,0 +1,53 @@
+/**
+* @file IndexBoard.cpp
+* @brief Implements members of the IndexBoard class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#include <stdexcept>
+#include "IndexBoard.hpp"
+#include "../Constants.hpp"
+
+using Constants::BOARD_SIZE;
+
+namespace Sudoku {
+	IndexBoard::IndexBoard() {
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++)
+				this->board[i][j] = EMPTY;
+		}
+	}
+
+	IndexBoard::IndexBoard(const Board& board) {
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(board[i][j] == Constants::EMPTY_CELL){
+					this->board[i][j] = EMPTY;
+					continue;
+				}
+				int k = Constants::keyIndex(board[i][j]);
+				if(k < 0)
+					throw std::invalid_argument("Invalid character on the board.");
+				this->board[i][j] = static_cast<int8_t>(k);
+			}
+		}
+	}
+
+	void IndexBoard::toBoard(Board& board) const {
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				int8_t k = this->board[i][j];
+				board[i][j] = k == EMPTY ? Constants::EMPTY_CELL : Constants::ALPHABET[k];
+			}
+		}
+	}
+
+	int8_t* IndexBoard::operator[](int rowIdx){
+		return this->board[rowIdx];
+	}
+
+	const int8_t* IndexBoard::operator[](int rowIdx) const {
+		return this->board[rowIdx];
+	}
+}
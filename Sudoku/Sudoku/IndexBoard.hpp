@@ -0,0 +1,61 @@
+/**
+* @file IndexBoard.hpp
+* @brief Defines the IndexBoard class.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "Board.hpp"
+#include "../Constants.hpp"
+
+namespace Sudoku {
+    /**
+     * @brief Sudoku board that stores the index of every value in Constants::ALPHABET instead of its character.
+     *
+     * @details Hot loops that work on value indices (candidate masks, unit checks) read the cells directly,
+     * without translating each character. The characters are translated once, when the board is converted
+     * from or to a Board.
+     */
+    class IndexBoard {
+    public:
+        static const int8_t EMPTY = -1; /**< Index stored in empty cells. */
+
+        /**
+         * @brief Default constructor. Creates an empty board.
+         */
+        IndexBoard();
+
+        /**
+         * @brief Constructor. Translates the characters of the given board to their indices.
+         * @param board The board to convert.
+         * @throw std::invalid_argument if a cell holds a character outside of Constants::ALPHABET
+         */
+        explicit IndexBoard(const Board& board);
+
+        /**
+         * @brief Writes the board back as characters.
+         * @param board The board to write to.
+         */
+        void toBoard(Board& board) const;
+
+        /**
+         * @brief Overloaded indexing operator for non-constant objects. Provides access to the specified row of the board.
+         * @param rowIdx The index of the row to access.
+         * @return A pointer to the specified row, holding the value index of every cell or EMPTY.
+         */
+        int8_t* operator[](int rowIdx);
+
+        /**
+         * @brief Overloaded indexing operator for constant objects. Provides read-only access to the specified row of the board.
+         * @param rowIdx The index of the row to access.
+         * @return A constant pointer to the specified row, holding the value index of every cell or EMPTY.
+         */
+        const int8_t* operator[](int rowIdx) const;
+
+    private:
+        int8_t board[BOARD_SIZE][BOARD_SIZE]; /**< Value index of every cell, EMPTY for empty cells. */
+    };
+}
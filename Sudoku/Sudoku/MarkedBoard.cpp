@@ -5,42 +5,84 @@
 * @date 25.12.2023
 */
 
+#include <stdexcept>
 #include "MarkedBoard.hpp"
 #include "Board.hpp"
 
 namespace Sudoku{
-	MarkedBoard::MarkedBoard(){}
+	template<int BlockSize>
+	const typename BasicMarkedBoard<BlockSize>::PeerTable BasicMarkedBoard<BlockSize>::PEERS = BasicMarkedBoard<BlockSize>::buildPeerTable();
 
-	MarkedBoard::MarkedBoard(const MarkedBoard& other) : Board(other) {
-		for(int i=0; i<BOARD_SIZE; i++){
+	template<int BlockSize>
+	typename BasicMarkedBoard<BlockSize>::PeerTable BasicMarkedBoard<BlockSize>::buildPeerTable(){
+		PeerTable table;
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
+				int cell = i*SIZE + j, cnt = 0;
+				auto add = [&](int r, int c){
+					table.row[cell][cnt] = static_cast<uint8_t>(r);
+					table.col[cell][cnt] = static_cast<uint8_t>(c);
+					table.block[cell][cnt] = static_cast<uint8_t>(BoardType::getBlockNum(r, c));
+					cnt++;
+				};
+				for(int k=0; k<SIZE; k++){
+					if(k != j) add(i, k);
+					if(k != i) add(k, j);
+				}
+				int br = (i/BlockSize)*BlockSize, bc = (j/BlockSize)*BlockSize;
+				for(int r=br; r<br+BlockSize; r++){
+					for(int c=bc; c<bc+BlockSize; c++){
+						if(r != i && c != j) add(r, c);
+					}
+				}
+			}
+		}
+		return table;
+	}
+
+	template<int BlockSize>
+	BasicMarkedBoard<BlockSize>::BasicMarkedBoard(){
+		this->calculateMarks();
+	}
+
+	template<int BlockSize>
+	BasicMarkedBoard<BlockSize>::BasicMarkedBoard(const BasicMarkedBoard& other) : BoardType(other) {
+		for(int i=0; i<SIZE; i++){
 			this->rowSets[i] = other.rowSets[i];
 			this->colSets[i] = other.colSets[i];
 			this->blockSets[i] = other.blockSets[i];
+			for(int j=0; j<SIZE; j++)
+				this->candidateCounts[i][j] = other.candidateCounts[i][j];
 		}
 	}
 
-	MarkedBoard::MarkedBoard(const Board& other) : Board(other) {
+	template<int BlockSize>
+	BasicMarkedBoard<BlockSize>::BasicMarkedBoard(const BoardType& other) : BoardType(other) {
 		this->calculateMarks();
 	}
 
-	MarkedBoard& MarkedBoard::operator=(const MarkedBoard& other){
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+	template<int BlockSize>
+	BasicMarkedBoard<BlockSize>& BasicMarkedBoard<BlockSize>::operator=(const BasicMarkedBoard& other){
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				(*this)[i][j] = other[i][j];
 			}
 		}
-		for(int i=0; i<BOARD_SIZE; i++){
+		for(int i=0; i<SIZE; i++){
 			this->rowSets[i] = other.rowSets[i];
 			this->colSets[i] = other.colSets[i];
 			this->blockSets[i] = other.blockSets[i];
+			for(int j=0; j<SIZE; j++)
+				this->candidateCounts[i][j] = other.candidateCounts[i][j];
 		}
 		return *this;
 	}
 
-	MarkedBoard& MarkedBoard::operator=(const Board & other)
+	template<int BlockSize>
+	BasicMarkedBoard<BlockSize>& BasicMarkedBoard<BlockSize>::operator=(const BoardType & other)
 	{
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				(*this)[i][j] = other[i][j];
 			}
 		}
@@ -48,22 +90,93 @@ namespace Sudoku{
 		return *this;
 	}
 
-	void MarkedBoard::calculateMarks() {
-		for(int i=0; i<BOARD_SIZE; i++){
+	template<int BlockSize>
+	void BasicMarkedBoard<BlockSize>::calculateMarks() {
+		for(int i=0; i<SIZE; i++){
 			this->rowSets[i].reset();
 			this->colSets[i].reset();
 			this->blockSets[i].reset();
 		}
-		for(int i=0; i<BOARD_SIZE; i++){
-			for(int j=0; j<BOARD_SIZE; j++){
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
 				if((*this)[i][j] == Constants::EMPTY_CELL)
 					continue;
-				int idx = Constants::KEY_IDX.at((*this)[i][j]);
+				int idx = Traits::index((*this)[i][j]);
+				if(idx < 0){
+					throw std::invalid_argument("Invalid character on the board.");
+				}
 				this->rowSets[i][idx] = true;
 				this->colSets[j][idx] = true;
 				this->blockSets[this->getBlockNum(i, j)][idx] = true;
 			}
 		}
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++)
+				this->candidateCounts[i][j] = static_cast<uint8_t>(this->getCandidates(i, j).count());
+		}
+	}
+
+	template<int BlockSize>
+	std::bitset<BasicMarkedBoard<BlockSize>::SIZE> BasicMarkedBoard<BlockSize>::getCandidates(int rowIdx, int colIdx) const {
+		return ~(this->rowSets[rowIdx] | this->colSets[colIdx] | this->blockSets[BoardType::getBlockNum(rowIdx, colIdx)]);
+	}
+
+	template<int BlockSize>
+	int BasicMarkedBoard<BlockSize>::getCandidateCount(int rowIdx, int colIdx) const {
+		return this->candidateCounts[rowIdx][colIdx];
+	}
+
+	template<int BlockSize>
+	bool BasicMarkedBoard<BlockSize>::isCandidate(int rowIdx, int colIdx, int k) const {
+		return !this->rowSets[rowIdx][k] && !this->colSets[colIdx][k] && !this->blockSets[BoardType::getBlockNum(rowIdx, colIdx)][k];
+	}
+
+	template<int BlockSize>
+	void BasicMarkedBoard<BlockSize>::placeValue(int rowIdx, int colIdx, int k){
+		// peers that still had k as a candidate lose it
+		int cell = rowIdx*SIZE + colIdx;
+		for(int p=0; p<PEER_COUNT; p++){
+			int ri = PEERS.row[cell][p], ci = PEERS.col[cell][p];
+			if((*this)[ri][ci] == Constants::EMPTY_CELL && !this->rowSets[ri][k] && !this->colSets[ci][k] && !this->blockSets[PEERS.block[cell][p]][k])
+				this->candidateCounts[ri][ci]--;
+		}
+		(*this)[rowIdx][colIdx] = Traits::symbol(k);
+		this->rowSets[rowIdx][k] = this->colSets[colIdx][k] = this->blockSets[BoardType::getBlockNum(rowIdx, colIdx)][k] = true;
+	}
+
+	template<int BlockSize>
+	void BasicMarkedBoard<BlockSize>::removeValue(int rowIdx, int colIdx, int k){
+		(*this)[rowIdx][colIdx] = Constants::EMPTY_CELL;
+		this->rowSets[rowIdx][k] = this->colSets[colIdx][k] = this->blockSets[BoardType::getBlockNum(rowIdx, colIdx)][k] = false;
+		// peers for which k became a candidate again gain it back
+		int cell = rowIdx*SIZE + colIdx;
+		for(int p=0; p<PEER_COUNT; p++){
+			int ri = PEERS.row[cell][p], ci = PEERS.col[cell][p];
+			if((*this)[ri][ci] == Constants::EMPTY_CELL && !this->rowSets[ri][k] && !this->colSets[ci][k] && !this->blockSets[PEERS.block[cell][p]][k])
+				this->candidateCounts[ri][ci]++;
+		}
+		this->candidateCounts[rowIdx][colIdx] = static_cast<uint8_t>(this->getCandidates(rowIdx, colIdx).count());
+	}
+
+	template<int BlockSize>
+	bool BasicMarkedBoard<BlockSize>::findMostConstrainedCell(int& rowIdx, int& colIdx) const {
+		int best_cnt = SIZE + 1;
+		for(int i=0; i<SIZE; i++){
+			for(int j=0; j<SIZE; j++){
+				if((*this)[i][j] != Constants::EMPTY_CELL || this->candidateCounts[i][j] >= best_cnt)
+					continue;
+				rowIdx = i;
+				colIdx = j;
+				best_cnt = this->candidateCounts[i][j];
+				if(best_cnt <= 1) return true; // cannot do better than a dead end or a forced value
+			}
+		}
+		return best_cnt <= SIZE;
 	}
 
+	// every supported size is compiled here, so the members stay out of the header
+	template class BasicMarkedBoard<2>;
+	template class BasicMarkedBoard<3>;
+	template class BasicMarkedBoard<4>;
+	template class BasicMarkedBoard<5>;
 }
\ No newline at end of file
@@ -9,52 +9,146 @@
 
 #include "Board.hpp"
 #include <bitset>
+#include <cstdint>
 
 namespace Sudoku {
     /**
      * @brief Class that represents a marked Sudoku board, with additional information about possible marks in each cell.
+     *
+     * @details The size is a template parameter, like the one of BasicBoard. The members are defined in MarkedBoard.cpp
+     * and instantiated there for the 4x4, 9x9, 16x16 and 25x25 boards.
+     *
+     * @tparam BlockSize Number of rows and columns of a block.
      */
-    class MarkedBoard : public Board {
+    template<int BlockSize>
+    class BasicMarkedBoard : public BasicBoard<BlockSize> {
     public:
+        typedef BoardTraits<BlockSize> Traits; /**< Dimensions and alphabet of the board. */
+        typedef BasicBoard<BlockSize> BoardType; /**< Board the marks are kept for. */
+
+        static const int SIZE = Traits::BOARD_SIZE; /**< Number of rows, columns, blocks and values. */
+
         /**
          * @brief Default constructor. Creates an empty marked Sudoku board.
          */
-        MarkedBoard();
+        BasicMarkedBoard();
 
         /**
          * @brief Copy constructor. Constructs a marked Sudoku board with the copy of the contents of another board.
          * @param other The Sudoku board to copy.
+         * @throw std::invalid_argument if a cell holds a character outside of the alphabet of the size
          */
-        MarkedBoard(const Board& other);
+        BasicMarkedBoard(const BoardType& other);
 
         /**
          * @brief Copy constructor. Performs a deep copy of the marked Sudoku board.
          * @param other The marked Sudoku board to copy.
          */
-        MarkedBoard(const MarkedBoard& other);
+        BasicMarkedBoard(const BasicMarkedBoard& other);
 
         /**
          * @brief Assignment operator. Constructs a marked Sudoku board with the copy of the contents of another board.
          * @param other The Sudoku board to copy.
          * @return A reference to the modified marked Sudoku board.
+         * @throw std::invalid_argument if a cell holds a character outside of the alphabet of the size
          */
-        MarkedBoard& operator=(const Board& other);
+        BasicMarkedBoard& operator=(const BoardType& other);
 
         /**
          * @brief Assignment operator. Performs a deep copy of the marked Sudoku board.
          * @param other The marked Sudoku board to copy.
          * @return A reference to the modified marked Sudoku board.
          */
-        MarkedBoard& operator=(const MarkedBoard& other);
+        BasicMarkedBoard& operator=(const BasicMarkedBoard& other);
+
+        /**
+         * @brief Writes the k-th character of the alphabet to an empty cell and updates the marks.
+         *
+         * @details Keeps the candidate count of every empty cell up to date, so the marks stay consistent
+         * only if the cells are changed through placeValue and removeValue.
+         *
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @param k The index of the value in the alphabet, see BoardTraits::index.
+         */
+        void placeValue(int rowIdx, int colIdx, int k);
+
+        /**
+         * @brief Clears a cell previously filled with placeValue and updates the marks.
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @param k The index of the value in the alphabet that the cell holds.
+         */
+        void removeValue(int rowIdx, int colIdx, int k);
+
+        /**
+         * @brief Returns the values that can still be written to the given cell.
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @return Bitset with the k-th bit set if the k-th value of the alphabet is not taken in the cell's row, column or block.
+         */
+        std::bitset<SIZE> getCandidates(int rowIdx, int colIdx) const;
+
+        /**
+         * @brief Returns the number of values that can still be written to the given empty cell.
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @return The number of candidates of the cell. Undefined for filled cells.
+         */
+        int getCandidateCount(int rowIdx, int colIdx) const;
+
+        /**
+         * @brief Checks if the k-th value of the alphabet can still be written to the given cell.
+         * @param rowIdx The row index of the cell.
+         * @param colIdx The column index of the cell.
+         * @param k The index of the value in the alphabet.
+         * @return true if the value is not taken in the cell's row, column or block.
+         */
+        bool isCandidate(int rowIdx, int colIdx, int k) const;
+
+        /**
+         * @brief Finds the empty cell with the fewest candidates (the most constrained cell).
+         * @param rowIdx Reference to the variable where the row index of the cell should be saved.
+         * @param colIdx Reference to the variable where the column index of the cell should be saved.
+         * @return false if the board has no empty cells, true otherwise.
+         */
+        bool findMostConstrainedCell(int& rowIdx, int& colIdx) const;
 
-        std::bitset<BOARD_SIZE> rowSets[BOARD_SIZE]; /**< Array of bitsets representing possible marks for each row. */
-        std::bitset<BOARD_SIZE> colSets[BOARD_SIZE]; /**< Array of bitsets representing possible marks for each column. */
-        std::bitset<BOARD_SIZE> blockSets[BOARD_SIZE]; /**< Array of bitsets representing possible marks for each block. */
+        std::bitset<SIZE> rowSets[SIZE]; /**< Array of bitsets representing possible marks for each row. */
+        std::bitset<SIZE> colSets[SIZE]; /**< Array of bitsets representing possible marks for each column. */
+        std::bitset<SIZE> blockSets[SIZE]; /**< Array of bitsets representing possible marks for each block. */
 
     private:
+        static const int PEER_COUNT = 3*(SIZE-1) - 2*(BlockSize-1); /**< Number of distinct cells sharing a unit with a cell. */
+
+        /**
+         * @brief Cells sharing a row, column or block with each cell (indexed by rowIdx*SIZE + colIdx).
+         */
+        struct PeerTable {
+            uint8_t row[SIZE*SIZE][PEER_COUNT]; /**< Row index of each peer. */
+            uint8_t col[SIZE*SIZE][PEER_COUNT]; /**< Column index of each peer. */
+            uint8_t block[SIZE*SIZE][PEER_COUNT]; /**< Block number of each peer. */
+        };
+
+        static const PeerTable PEERS; /**< Peers of every cell. */
+
+        /**
+         * @brief Builds the PEERS table.
+         * @return The peers of every cell.
+         */
+        static PeerTable buildPeerTable();
+
+        uint8_t candidateCounts[SIZE][SIZE]; /**< Number of candidates of each empty cell. Undefined for filled cells. */
+
         /**
          * @brief Private method to calculate possible marks for each cell on the marked Sudoku board.
+         * @throw std::invalid_argument if a cell holds a character outside of the alphabet of the size
          */
         void calculateMarks();
     };
-}
+
+    /**
+     * @brief The classic 9x9 marked board used by the solver engines, the generator and the grader.
+     */
+    typedef BasicMarkedBoard<Constants::BLOCK_SIZE> MarkedBoard;
+}
\ No newline at end of file
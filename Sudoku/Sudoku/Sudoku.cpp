@@ -6,6 +6,7 @@
  */
 
 #include <string>
+#include <stdexcept>
 #include "Sudoku.hpp"
 #include "../FileIO/FileIO.hpp"
 
@@ -28,6 +29,14 @@ namespace Sudoku {
 		this->round_counter++;
 	}
 
+	void Sudoku::setSolverEngine(SolverEngine engine){
+		this->solver.setEngine(engine);
+	}
+
+	void Sudoku::setGeneratorThreadCount(int thread_count){
+		this->generator.setThreadCount(thread_count);
+	}
+
 	int Sudoku::getCorrectValues(){
 		return this->correct_values;
 	}
@@ -41,12 +50,22 @@ namespace Sudoku {
 	}
 
 	bool Sudoku::loadStartBoardFromFile(){
-		FileIO::loadFromFile(this->start_filename, this->start_board);
+		try{
+			FileIO::loadFromFile(this->start_filename, this->start_board);
+		}
+		catch(const std::invalid_argument&){
+			return false;
+		}
 		return this->checker.isValid(this->start_board);
 	}
 
 	void Sudoku::loadSolvedBoardFromFile(){
-		FileIO::loadFromFile(this->solution_filename, this->game_board);
+		try{
+			FileIO::loadFromFile(this->solution_filename, this->game_board);
+		}
+		catch(const std::invalid_argument&){
+			this->game_board = MarkedBoard(); // an unreadable solution counts as all cells left empty
+		}
 	}
 
 	void Sudoku::generateStartBoard(){
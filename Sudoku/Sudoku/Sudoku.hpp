@@ -40,6 +40,18 @@ namespace Sudoku{
          */
 		void incrementRoundCounter();
 
+        /**
+         * @brief Sets the search engine used by the solver.
+         * @param engine The new search engine.
+         */
+		void setSolverEngine(SolverEngine engine);
+
+        /**
+         * @brief Sets the number of threads of the uniqueness checks of the generator.
+         * @param thread_count The number of threads. 0 uses every hardware thread.
+         */
+		void setGeneratorThreadCount(int thread_count);
+
         /**
          * @brief Getter for correct_values.
          * @return Number of correct values.
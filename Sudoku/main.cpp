@@ -6,11 +6,19 @@
 */
 
 #include <iostream>
+#include <fstream>
+#include <chrono>
+#include <memory>
 #include "Constants.hpp"
-#include "Sudoku\Sudoku.hpp"
-#include "Menu\Menu.hpp"
-#include "FileIO\FileIO.hpp"
-#include "CommandLine\ArgumentParser.hpp"
+#include "Sudoku/Sudoku.hpp"
+#include "Menu/Menu.hpp"
+#include "FileIO/FileIO.hpp"
+#include "FileIO/MappedPuzzleReader.hpp"
+#include "FileIO/BinaryFormat.hpp"
+#include "CommandLine/ArgumentParser.hpp"
+#include "Batch/BatchSolver.hpp"
+#include "Batch/BatchGenerator.hpp"
+#include "Server/RequestServer.hpp"
 
 int main(int argc, char *argv[])
 {
@@ -20,14 +28,133 @@ int main(int argc, char *argv[])
     }
     catch(const std::invalid_argument& e){
         std::cerr << e.what() << '\n';
-        std::cerr << "Usage: " << argv[0] << " [-u] [-d <e|m|h>] <start_filename> <solution_filename>\n";
+        std::cerr << "Usage: " << argv[0] << " [-u] [-d <e|m|h>] [-s <b|m|x>] [-j <threads>] <start_filename> <solution_filename>\n";
+        std::cerr << "       " << argv[0] << " --batch [-s <b|m|x>] [-j <threads>] [--unordered] [--cache <entries>] <puzzles_filename> <solutions_filename>\n";
+        std::cerr << "       " << argv[0] << " --convert [-f <g|l>] <input_filename> <output_filename>\n";
+        std::cerr << "       " << argv[0] << " --generate <count> [-u] [-d <e|m|h>] [-g <s|m|a|e|b>] [-s <b|m|x>] [-j <threads>] [--seed <seed>] [-f <g|l|b>] <output_filename>\n";
+        std::cerr << "       " << argv[0] << " --serve [-s <b|m|x>] [-j <threads>] [--cache <entries>] [--socket <path>]\n";
         return 1;
     }
 
+    if(cmdArgParser.getConvert()){
+        try{
+            std::string input = cmdArgParser.getStartFilename();
+            std::string output = cmdArgParser.getSolutionFilename();
+            uint64_t converted = FileIO::isBinaryFile(input) ?
+                FileIO::binaryToText(input, output, cmdArgParser.getFormat()) :
+                FileIO::textToBinary(input, output);
+            std::cerr << "Converted " << converted << " boards.\n";
+        }
+        catch(const std::invalid_argument& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        catch(const std::runtime_error& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        return 0;
+    }
+
+    if(cmdArgParser.getGenerateCount() > 0){
+        uint64_t seed = cmdArgParser.getSeedSet() ? cmdArgParser.getSeed() : Sudoku::SudokuGenerator::randomSeed();
+        Sudoku::BatchGenerator batch_generator(
+            cmdArgParser.getDifficulty(), cmdArgParser.getUnique(), cmdArgParser.getThreadCount(), seed
+        );
+        batch_generator.setSolverEngine(cmdArgParser.getSolverEngine());
+        if(cmdArgParser.getGradeSet())
+            batch_generator.setTargetGrade(cmdArgParser.getTargetGrade());
+        auto begin = std::chrono::steady_clock::now();
+        try{
+            if(cmdArgParser.getFormat() == FileIO::BINARY){
+                FileIO::BinaryPuzzleWriter writer(cmdArgParser.getStartFilename());
+                batch_generator.generate(cmdArgParser.getGenerateCount(), writer);
+                writer.close();
+            } else {
+                std::ofstream out(cmdArgParser.getStartFilename());
+                if(!out){
+                    std::cerr << "Cannot open '" << cmdArgParser.getStartFilename() << "' for writing.\n";
+                    return 1;
+                }
+                batch_generator.generate(cmdArgParser.getGenerateCount(), out, cmdArgParser.getFormat());
+            }
+        }
+        catch(const std::invalid_argument& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        catch(const std::runtime_error& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        std::cerr << "Generated: " << cmdArgParser.getGenerateCount() << ", seed: " << seed
+                  << ", threads: " << batch_generator.getThreadCount() << ", time: " << elapsed.count() << "s\n";
+        return 0;
+    }
+
+    if(cmdArgParser.getServe()){
+        Server::RequestServer server(cmdArgParser.getSolverEngine(), cmdArgParser.getThreadCount());
+        server.setCacheCapacity(cmdArgParser.getCacheCapacity());
+        std::string socket_path = cmdArgParser.getSocketPath();
+        auto begin = std::chrono::steady_clock::now();
+        Server::ServerStats stats;
+        try{
+            stats = socket_path.empty() ? server.serve(std::cin, std::cout) : server.serveSocket(socket_path);
+        }
+        catch(const std::runtime_error& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        std::cerr << "Connections: " << stats.connections << ", requests: " << stats.requests << ", errors: " << stats.errors
+                  << ", batches: " << stats.batches << ", largest batch: " << stats.max_batch
+                  << ", threads: " << server.getThreadCount() << ", time: " << elapsed.count() << "s\n";
+        if(cmdArgParser.getCacheCapacity() > 0)
+            std::cerr << "Solves: " << stats.solver.solves << ", cache hits: " << stats.solver.cache_hits << '\n';
+        return 0;
+    }
+
+    if(cmdArgParser.getBatch()){
+        std::unique_ptr<FileIO::MappedPuzzleReader> in;
+        try{
+            in.reset(new FileIO::MappedPuzzleReader(cmdArgParser.getStartFilename()));
+        }
+        catch(const std::invalid_argument& e){
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        std::ofstream out(cmdArgParser.getSolutionFilename());
+        if(!out){
+            std::cerr << "Cannot open '" << cmdArgParser.getSolutionFilename() << "' for writing.\n";
+            return 1;
+        }
+        Sudoku::BatchSolver batch_solver(
+            cmdArgParser.getSolverEngine(), cmdArgParser.getThreadCount(), cmdArgParser.getOrdered()
+        );
+        batch_solver.setCacheCapacity(cmdArgParser.getCacheCapacity());
+        auto begin = std::chrono::steady_clock::now();
+        Sudoku::BatchResult result = batch_solver.solve(*in, out);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        std::cerr << "Puzzles: " << result.puzzles << ", solved: " << result.solved
+                  << ", unsolvable: " << result.unsolvable << ", invalid: " << result.invalid
+                  << ", threads: " << batch_solver.getThreadCount() << ", time: " << elapsed.count() << "s\n";
+        const Sudoku::SolverStats& stats = result.stats;
+        std::cerr << "Search nodes: " << stats.nodes << ", backtracks: " << stats.backtracks << ", max depth: " << stats.max_depth
+                  << ", propagated cells: " << stats.getPropagations() << ", slowest puzzle: "
+                  << std::chrono::duration<double, std::micro>(stats.max_time).count() << "us\n";
+        if(cmdArgParser.getCacheCapacity() > 0)
+            std::cerr << "Cache hits: " << stats.cache_hits << '\n';
+        return result.solved == result.puzzles ? 0 : 2;
+    }
+
     Sudoku::Sudoku game(
         cmdArgParser.getStartFilename(), cmdArgParser.getSolutionFilename(),
         cmdArgParser.getDifficulty(), cmdArgParser.getUnique()
     );
+    game.setSolverEngine(cmdArgParser.getSolverEngine());
+    if(cmdArgParser.getThreadCount() > 0)
+        game.setGeneratorThreadCount(cmdArgParser.getThreadCount());
 
     Menu::printWelcomeMessage();
 
@@ -0,0 +1,75 @@
+/**
+* @file BenchmarkCorpus.hpp
+* @brief Fixed puzzle sets timed by the benchmark suite.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*
+* @details Every puzzle is in the line format of the batch mode and has exactly one solution. The sets are part of the
+* source so that every run, on every machine, times the same boards.
+*/
+
+#pragma once
+
+namespace BenchmarkCorpus {
+	const int PUZZLE_COUNT = 16; /**< Number of puzzles in every set. */
+
+	/** Puzzles of 31 to 33 givens that naked and hidden singles solve. */
+	const char* const EASY[PUZZLE_COUNT] = {
+		"3....7295...3.9.6.279..683..18...5..7..4....8...69.3.1...96..5..2..354.......49..",
+		"9..28..54.8.9.4...62.37........41286.67..9.....8....7..7...2..88.6197..25...6....",
+		"...64.7..2....8..9.872.9..1854.1.9..1...976....6....4..9.5...14.4.....9...2..43.5",
+		"..8.2647..23.48....7413..58...38...7.....236...2..........1.794.4..9318.8........",
+		".4695..7.31..2..988....3......3..4..63...17.97..8.9....79..4.32.82....6......2..7",
+		"1...5...8..6.8..9....63.5..538.1.9...4.8....76174.58...7........91..6...3.45.17..",
+		"29.5...8..38.4...7...9..5..612....7...9.25....54.63...9..8.4236.6..7.9.8.......4.",
+		"67.9.25.3....3.......5..2..7..2....4.6..9.81.84367.925..48..7.....4....692...5...",
+		"...........3...48.....549.3.65.1.73...756281..4.3...26....31....14.79....8.2..3..",
+		".....9......87.4.9..8.317..8.......47..69.5..9.3..8...4..3.6..263.28.14....9..3.6",
+		"...1......742.3.9.3...7......83475.....5.1.29..1.....8.8269.47.9.3.1......6.3.9..",
+		"..1..672...2.8..1....12.86.297.5......6.9..7834.....9......5..28..4.13....3..2..1",
+		"..37.2....6.8..35.975.......342685...9..158.38.....6......8.7....6.....83.81..4..",
+		"..4983.2....42..95..87.....83.....54.6.2...8....5....39.3....4.....9.5781.58...6.",
+		"..651..92...6.....8......5..2..45.6.145.6.82..7..9..43.......3..19...675..2.53...",
+		".3......2..2.6.4.567..4....2..186..9.1..9..4.9.34.......8.349...6.85.1.......7.64"
+	};
+
+	/** Puzzles of 24 to 26 givens that the technique grader cannot solve, so every engine has to search. */
+	const char* const HARD[PUZZLE_COUNT] = {
+		".........1.4.3......21..6...2.....34.....5..8..6...51..7..8.2...6..4..719...26...",
+		"....7.5.....3.1.....96.5....83.....5............7.463.4.258..9.....42.7.96......4",
+		"....7.59..2..6..747.....38.1645.9....7........95..3.....6.....3...4..8...5..9....",
+		"..18.3..73.5............52.8.7...6.9...9.5........71.....4687..2...1.....6....98.",
+		"..9.....3.36..5...5...8....3..7......4.1...58...65...1.....4.1..5..7.4.97.....6.5",
+		".45..8..23...2.8.6...9.....7..4...1..367........26.79.9......3.....1...4..23.....",
+		".5..4....8...6.9.5.91..3.........3........4.94....8.2.......8.3..87..5.16..9.17..",
+		".58...4...9..32....6.7..1.......186..4.....19...2...5.3...67...6..3..7.5...4.....",
+		".65....4.24....1.......9..6..91..7......2..657..95......6..8..3.9..1...4..7...5..",
+		"2...5.34...9..4......17.....5.......9..6.257.4...9.26....9....35..4..6....1.8....",
+		"3......7..6.9.....8.4..7.....569.4.......4.....32...8.546...93....14...21.......6",
+		"6..........9.......2....153....4..8...1.76.3..7..5.2.....7....88....2.17..249..6.",
+		"........72.6.1.8..79.8..6....8..6.....517..3.9...4.21....46.7..8.3....9...2......",
+		".......4.59.8.......73..........5.3.2..6.9...3891.7.5.......8.387..5.9.1.2.....7.",
+		".......51.6.1..9..3...5...8534.872...........9764...........48...2..6...1.8..2.6.",
+		".......526.98......1...6.9......85..47.5..3.9..2....1452...1..6..14...8.7........"
+	};
+
+	/** Puzzles with the minimum of 17 givens: one known puzzle and relabelings, row, column and band permutations and transpositions of it. */
+	const char* const SEVENTEEN_CLUE[PUZZLE_COUNT] = {
+		".......1.4.........2...........5.4.7..8...3....1.9....3..4..2...5.1........8.6...",
+		"...6....1...53......27..9.......4.6...9....5.8.7..1....6...............2......7..",
+		"......1.8653......9................4..2....73.....5.........56..8..2......73.....",
+		"....8.....5.......29......71.8...........7.3....9....2......6........189.34......",
+		".5....6..9......7....8.4...........4.7.56........2......1..........93...468......",
+		"3......6....5.9....7......4....8.......47...3..9............2........597....61...",
+		"92............61......7...5......692.35.............8...4......1.6...7.....2.....",
+		"...76......5......241......3.....2...6.....8....4.1...8...23...........4....9....",
+		".....9...2........13.....4..59.........1...3.....4...6......5196.8............7..",
+		"..4....6.....19...7.....8.....4.3...819.......5.......6..87.......2.............9",
+		"6...3...492.......8..5.........6.......4............8......9..3..1..8.....5...7.6",
+		"...639..........54...2.......3...........81.9........7......63..8..4....9....1...",
+		".....8...4............13..2...45......3.....1.2.....6....7.6.........9........543",
+		"........4...8...29.3..........973.........1.6....5..........37.9..2.......8..6...",
+		".4....9.1....3...8.6..2.........7......1............2.2....4...1..8....73.5......",
+		"..7.....1....85....3....6.....7.9...865......4.........1.63.......2............5."
+	};
+}
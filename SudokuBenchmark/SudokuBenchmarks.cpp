@@ -0,0 +1,516 @@
+/**
+* @file SudokuBenchmarks.cpp
+* @brief Google Benchmark suite of the solver, generator, checker and file I/O.
+* @author Nikola Jolovic
+* @date 18.10.2026
+*
+* @details The solver and checker benchmarks run on the fixed sets of BenchmarkCorpus and the generator benchmarks on
+* fixed seeds, so two runs of the same build time the same work and a regression shows up as a difference between runs.
+* Every benchmark reports the boards it processed per second. The checker and unit set benchmarks also time the std::map
+* lookup that Constants::KEY_IDX replaced and the IndexBoard that holds the indices directly. Compare two builds with the compare.py tool of Google
+* Benchmark, e.g. after running both with --benchmark_out=<file>. Build it with optimizations enabled.
+*/
+
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "../Sudoku/Sudoku/Board.cpp"
+#include "../Sudoku/Sudoku/MarkedBoard.hpp"
+#include "../Sudoku/Sudoku/MarkedBoard.cpp"
+#include "../Sudoku/Sudoku/IndexBoard.hpp"
+#include "../Sudoku/Sudoku/IndexBoard.cpp"
+#include "../Sudoku/Sudoku/BoardBatch.hpp"
+#include "../Sudoku/Sudoku/BoardBatch.cpp"
+#include "../Sudoku/Sudoku/CanonicalForm.hpp"
+#include "../Sudoku/Sudoku/CanonicalForm.cpp"
+#include "../Sudoku/Checker/SudokuChecker.hpp"
+#include "../Sudoku/Checker/SudokuChecker.cpp"
+#include "../Sudoku/Solver/SudokuSolver.hpp"
+#include "../Sudoku/Solver/SudokuSolver.cpp"
+#include "../Sudoku/Solver/ConstraintPropagator.hpp"
+#include "../Sudoku/Solver/ConstraintPropagator.cpp"
+#include "../Sudoku/Solver/BitboardSolver.hpp"
+#include "../Sudoku/Solver/BitboardSolver.cpp"
+#include "../Sudoku/Solver/DancingLinks.hpp"
+#include "../Sudoku/Solver/DancingLinks.cpp"
+#include "../Sudoku/Solver/SearchBudget.hpp"
+#include "../Sudoku/Solver/SearchBudget.cpp"
+#include "../Sudoku/Solver/SolverStats.hpp"
+#include "../Sudoku/Solver/SolverStats.cpp"
+#include "../Sudoku/Solver/SolutionCache.hpp"
+#include "../Sudoku/Solver/SolutionCache.cpp"
+#include "../Sudoku/Grader/TechniqueGrader.hpp"
+#include "../Sudoku/Grader/TechniqueGrader.cpp"
+#include "../Sudoku/Batch/WorkStealingPool.hpp"
+#include "../Sudoku/Batch/WorkStealingPool.cpp"
+#include "../Sudoku/Generator/SudokuGenerator.hpp"
+#include "../Sudoku/Generator/SudokuGenerator.cpp"
+#include "../Sudoku/FileIO/FileIO.hpp"
+#include "../Sudoku/FileIO/FileIO.cpp"
+#include "../Sudoku/FileIO/MappedPuzzleReader.hpp"
+#include "../Sudoku/FileIO/MappedPuzzleReader.cpp"
+#include "../Sudoku/FileIO/BinaryFormat.hpp"
+#include "../Sudoku/FileIO/BinaryFormat.cpp"
+#include "../Sudoku/Constants.hpp"
+#include "BenchmarkCorpus.hpp"
+
+using BenchmarkCorpus::PUZZLE_COUNT;
+
+namespace {
+	const uint64_t GENERATOR_SEED = 20231226; /**< Seed of the first board of every generator benchmark. */
+	const int FILE_REPEAT = 64; /**< Copies of a corpus in the files read by the I/O benchmarks. */
+
+	/**
+	 * @brief Parses a puzzle set of BenchmarkCorpus.
+	 */
+	std::vector<Sudoku::Board> loadCorpus(const char* const* puzzles){
+		std::vector<Sudoku::Board> boards(PUZZLE_COUNT);
+		for(int i=0; i<PUZZLE_COUNT; i++)
+			FileIO::parseLine(puzzles[i], boards[i]);
+		return boards;
+	}
+
+	/**
+	 * @brief Solves every puzzle of a set, so the corpus is known to be valid and the checker has solutions to check.
+	 */
+	std::vector<Sudoku::Board> solveCorpus(const std::vector<Sudoku::Board>& puzzles){
+		Sudoku::SudokuSolver solver;
+		std::vector<Sudoku::Board> solutions(puzzles.size());
+		Sudoku::MarkedBoard solution;
+		for(size_t i=0; i<puzzles.size(); i++){
+			if(!solver.solve(puzzles[i], solution))
+				throw std::logic_error("A benchmark puzzle has no solution.");
+			solutions[i] = solution;
+		}
+		return solutions;
+	}
+
+	/**
+	 * @brief Path of a scratch file in the temporary directory, removed by the benchmark that writes it.
+	 */
+	std::string scratchFile(const char* name){
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+	void BM_Solve(benchmark::State& state, Sudoku::SolverEngine engine, const char* const* corpus){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(corpus);
+		Sudoku::SudokuSolver solver;
+		solver.setEngine(engine);
+		Sudoku::MarkedBoard solution;
+		Sudoku::SolverStats stats;
+		for(auto _ : state){
+			for(const Sudoku::Board& puzzle : puzzles){
+				bool solved = solver.solve(puzzle, solution, stats);
+				benchmark::DoNotOptimize(solved);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+		state.counters["nodes/board"] = benchmark::Counter(double(stats.nodes) / double(stats.solves));
+	}
+
+	void BM_Canonicalize(benchmark::State& state, const char* const* corpus){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(corpus);
+		Sudoku::CanonicalForm canonical_form;
+		Sudoku::Board canonical;
+		Sudoku::BoardTransform transform;
+		for(auto _ : state){
+			for(const Sudoku::Board& puzzle : puzzles){
+				bool found = canonical_form.canonicalize(puzzle, canonical, transform);
+				benchmark::DoNotOptimize(found);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_SolveCached(benchmark::State& state, const char* const* corpus, bool hits){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(corpus);
+		// with hits every solve after the first round is one, the cost of a hit is the lookup and the transform back,
+		// without them the cache is emptied before every round and each solve also pays the search and the uniqueness count
+		Sudoku::SolutionCache cache(PUZZLE_COUNT);
+		Sudoku::SudokuSolver solver(Sudoku::DANCING_LINKS);
+		solver.setSolutionCache(&cache);
+		Sudoku::MarkedBoard solution;
+		for(const Sudoku::Board& puzzle : puzzles)
+			solver.solve(puzzle, solution);
+		for(auto _ : state){
+			if(!hits)
+				cache.clear();
+			for(const Sudoku::Board& puzzle : puzzles){
+				bool solved = solver.solve(puzzle, solution);
+				benchmark::DoNotOptimize(solved);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_Generate(benchmark::State& state, Sudoku::Difficulty difficulty, bool unique){
+		Sudoku::SudokuGenerator generator(difficulty, unique);
+		uint64_t index = 0;
+		Sudoku::Board board;
+		for(auto _ : state){
+			// the n-th board of every run is generated from the same seed
+			generator.setSeed(Sudoku::SudokuGenerator::deriveSeed(GENERATOR_SEED, index++));
+			board = Sudoku::Board();
+			generator.generateBoard(board);
+			benchmark::DoNotOptimize(board);
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	void BM_IsValid(benchmark::State& state, const char* const* corpus){
+		std::vector<Sudoku::Board> boards = loadCorpus(corpus);
+		Sudoku::SudokuChecker checker;
+		for(auto _ : state){
+			for(const Sudoku::Board& board : boards){
+				bool valid = checker.isValid(board);
+				benchmark::DoNotOptimize(valid);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+		state.SetLabel(Sudoku::SudokuChecker::getKernelName());
+	}
+
+	void BM_IsValidBatch(benchmark::State& state){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		Sudoku::BoardBatch batch;
+		for(int r=0; r<FILE_REPEAT; r++){
+			for(const Sudoku::Board& board : boards)
+				batch.addBoard(board);
+		}
+		std::unique_ptr<bool[]> results(new bool[batch.size()]);
+		Sudoku::SudokuChecker checker;
+		for(auto _ : state){
+			size_t valid_cnt = checker.isValid(batch, results.get());
+			benchmark::DoNotOptimize(valid_cnt);
+		}
+		state.SetItemsProcessed(state.iterations() * batch.size());
+		state.SetLabel(Sudoku::SudokuChecker::getKernelName());
+	}
+
+	// the lookup that Constants::KEY_IDX used to be
+	const std::map<char, int> MAP_KEY_IDX = {
+		{'1', 0}, {'2', 1}, {'3', 2}, {'4', 3}, {'5', 4}, {'6', 5}, {'7', 6}, {'8', 7}, {'9', 8}
+	};
+
+	/**
+	 * @brief Previous SudokuChecker::isValid, one bitset per unit and a map lookup per cell.
+	 */
+	bool mapIsValid(const Sudoku::Board& board){
+		std::bitset<Constants::BOARD_SIZE> value_set;
+		for(int i=0; i<Constants::BOARD_SIZE; i++){
+			value_set.reset();
+			for(int j=0; j<Constants::BOARD_SIZE; j++){
+				if(board[i][j] == Constants::EMPTY_CELL)
+					continue;
+				int idx = MAP_KEY_IDX.at(board[i][j]);
+				if(value_set.test(idx))
+					return false;
+				value_set[idx] = true;
+			}
+		}
+		for(int j=0; j<Constants::BOARD_SIZE; j++){
+			value_set.reset();
+			for(int i=0; i<Constants::BOARD_SIZE; i++){
+				if(board[i][j] == Constants::EMPTY_CELL)
+					continue;
+				int idx = MAP_KEY_IDX.at(board[i][j]);
+				if(value_set.test(idx))
+					return false;
+				value_set[idx] = true;
+			}
+		}
+		for(int k=0; k<Constants::BOARD_SIZE; k++){
+			value_set.reset();
+			for(int i=0; i<Constants::BLOCK_SIZE; i++){
+				for(int j=0; j<Constants::BLOCK_SIZE; j++){
+					int ri = (k/Constants::BLOCK_SIZE)*Constants::BLOCK_SIZE + i;
+					int ci = (k%Constants::BLOCK_SIZE)*Constants::BLOCK_SIZE + j;
+					if(board[ri][ci] == Constants::EMPTY_CELL)
+						continue;
+					int idx = MAP_KEY_IDX.at(board[ri][ci]);
+					if(value_set.test(idx))
+						return false;
+					value_set[idx] = true;
+				}
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Unit value sets of the board, the way MarkedBoard used to build its marks.
+	 */
+	int mapMarks(const Sudoku::Board& board){
+		std::bitset<Constants::BOARD_SIZE> rows[Constants::BOARD_SIZE], cols[Constants::BOARD_SIZE], blocks[Constants::BOARD_SIZE];
+		for(int i=0; i<Constants::BOARD_SIZE; i++){
+			for(int j=0; j<Constants::BOARD_SIZE; j++){
+				if(board[i][j] == Constants::EMPTY_CELL)
+					continue;
+				int idx = MAP_KEY_IDX.at(board[i][j]);
+				rows[i][idx] = cols[j][idx] = blocks[Sudoku::Board::getBlockNum(i, j)][idx] = true;
+			}
+		}
+		return int(rows[0].count() + cols[0].count() + blocks[0].count());
+	}
+
+	/**
+	 * @brief Same unit value sets with the constexpr table.
+	 */
+	int tableMarks(const Sudoku::Board& board){
+		std::bitset<Constants::BOARD_SIZE> rows[Constants::BOARD_SIZE], cols[Constants::BOARD_SIZE], blocks[Constants::BOARD_SIZE];
+		for(int i=0; i<Constants::BOARD_SIZE; i++){
+			for(int j=0; j<Constants::BOARD_SIZE; j++){
+				int idx = Constants::keyIndex(board[i][j]);
+				if(idx < 0)
+					continue;
+				rows[i][idx] = cols[j][idx] = blocks[Sudoku::Board::getBlockNum(i, j)][idx] = true;
+			}
+		}
+		return int(rows[0].count() + cols[0].count() + blocks[0].count());
+	}
+
+	/**
+	 * @brief Same unit value sets read from an IndexBoard.
+	 */
+	int indexMarks(const Sudoku::IndexBoard& board){
+		std::bitset<Constants::BOARD_SIZE> rows[Constants::BOARD_SIZE], cols[Constants::BOARD_SIZE], blocks[Constants::BOARD_SIZE];
+		for(int i=0; i<Constants::BOARD_SIZE; i++){
+			for(int j=0; j<Constants::BOARD_SIZE; j++){
+				int idx = board[i][j];
+				if(idx == Sudoku::IndexBoard::EMPTY)
+					continue;
+				rows[i][idx] = cols[j][idx] = blocks[Sudoku::Board::getBlockNum(i, j)][idx] = true;
+			}
+		}
+		return int(rows[0].count() + cols[0].count() + blocks[0].count());
+	}
+
+	void BM_IsValidMap(benchmark::State& state, const char* const* corpus){
+		std::vector<Sudoku::Board> boards = loadCorpus(corpus);
+		for(auto _ : state){
+			for(const Sudoku::Board& board : boards){
+				bool valid = mapIsValid(board);
+				benchmark::DoNotOptimize(valid);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_IsValidIndexBoard(benchmark::State& state, const char* const* corpus){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(corpus);
+		std::vector<Sudoku::IndexBoard> boards(puzzles.begin(), puzzles.end());
+		Sudoku::SudokuChecker checker;
+		for(auto _ : state){
+			for(const Sudoku::IndexBoard& board : boards){
+				bool valid = checker.isValid(board);
+				benchmark::DoNotOptimize(valid);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_IsValidArray(benchmark::State& state){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(BenchmarkCorpus::HARD);
+		std::vector<Sudoku::Board> boards;
+		for(int r=0; r<FILE_REPEAT; r++)
+			boards.insert(boards.end(), puzzles.begin(), puzzles.end());
+		std::unique_ptr<bool[]> results(new bool[boards.size()]);
+		Sudoku::SudokuChecker checker;
+		for(auto _ : state){
+			size_t valid_cnt = checker.isValid(boards.data(), boards.size(), results.get());
+			benchmark::DoNotOptimize(valid_cnt);
+		}
+		state.SetItemsProcessed(state.iterations() * boards.size());
+		state.SetLabel(Sudoku::SudokuChecker::getKernelName());
+	}
+
+	void BM_UnitSets(benchmark::State& state, int (*marks)(const Sudoku::Board&)){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		for(auto _ : state){
+			for(const Sudoku::Board& board : boards){
+				int count = marks(board);
+				benchmark::DoNotOptimize(count);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_UnitSetsIndexBoard(benchmark::State& state){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(BenchmarkCorpus::HARD);
+		std::vector<Sudoku::IndexBoard> boards(puzzles.begin(), puzzles.end());
+		for(auto _ : state){
+			for(const Sudoku::IndexBoard& board : boards){
+				int count = indexMarks(board);
+				benchmark::DoNotOptimize(count);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_MarkedBoard(benchmark::State& state){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		for(auto _ : state){
+			for(const Sudoku::Board& board : boards){
+				Sudoku::MarkedBoard marked_board(board);
+				benchmark::DoNotOptimize(marked_board);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_IsSolved(benchmark::State& state){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(BenchmarkCorpus::HARD);
+		std::vector<Sudoku::Board> solutions = solveCorpus(puzzles);
+		Sudoku::SudokuChecker checker;
+		int correct, incorrect, empty;
+		for(auto _ : state){
+			for(int i=0; i<PUZZLE_COUNT; i++){
+				bool solved = checker.isSolved(solutions[i], puzzles[i], correct, incorrect, empty);
+				benchmark::DoNotOptimize(solved);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_IsSolvedReport(benchmark::State& state){
+		std::vector<Sudoku::Board> puzzles = loadCorpus(BenchmarkCorpus::HARD);
+		std::vector<Sudoku::Board> solutions = solveCorpus(puzzles);
+		Sudoku::SudokuChecker checker;
+		Sudoku::SolutionReport report;
+		for(auto _ : state){
+			for(int i=0; i<PUZZLE_COUNT; i++){
+				bool solved = checker.isSolved(solutions[i], puzzles[i], report);
+				benchmark::DoNotOptimize(solved);
+			}
+		}
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_SaveLoadFile(benchmark::State& state, FileIO::Format format){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		std::string filename = scratchFile("sudoku_benchmark_board.txt");
+		Sudoku::Board board;
+		for(auto _ : state){
+			for(const Sudoku::Board& b : boards){
+				FileIO::saveToFile(filename, b, format);
+				FileIO::loadFromFile(filename, board);
+			}
+			benchmark::DoNotOptimize(board);
+		}
+		std::remove(filename.c_str());
+		state.SetItemsProcessed(state.iterations() * PUZZLE_COUNT);
+	}
+
+	void BM_ParseLines(benchmark::State& state){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		std::ostringstream out;
+		for(int r=0; r<FILE_REPEAT; r++){
+			for(const Sudoku::Board& board : boards)
+				FileIO::writeLine(out, board);
+		}
+		const std::string text = out.str();
+		Sudoku::Board board;
+		for(auto _ : state){
+			std::istringstream in(text);
+			while(FileIO::readLine(in, board))
+				benchmark::DoNotOptimize(board);
+		}
+		state.SetItemsProcessed(state.iterations() * FILE_REPEAT * PUZZLE_COUNT);
+		state.SetBytesProcessed(state.iterations() * text.size());
+	}
+
+	void BM_MappedRead(benchmark::State& state){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		std::string filename = scratchFile("sudoku_benchmark_lines.txt");
+		{
+			std::ofstream out(filename);
+			for(int r=0; r<FILE_REPEAT; r++){
+				for(const Sudoku::Board& board : boards)
+					FileIO::writeLine(out, board);
+			}
+		}
+		Sudoku::Board board;
+		for(auto _ : state){
+			FileIO::MappedPuzzleReader reader(filename);
+			while(reader.next(board))
+				benchmark::DoNotOptimize(board);
+		}
+		std::remove(filename.c_str());
+		state.SetItemsProcessed(state.iterations() * FILE_REPEAT * PUZZLE_COUNT);
+	}
+
+	void BM_BinaryWriteRead(benchmark::State& state){
+		std::vector<Sudoku::Board> boards = loadCorpus(BenchmarkCorpus::HARD);
+		std::string filename = scratchFile("sudoku_benchmark_boards.bin");
+		Sudoku::Board board;
+		for(auto _ : state){
+			{
+				FileIO::BinaryPuzzleWriter writer(filename);
+				for(int r=0; r<FILE_REPEAT; r++){
+					for(const Sudoku::Board& b : boards)
+						writer.write(b);
+				}
+			}
+			FileIO::BinaryPuzzleReader reader(filename);
+			while(reader.next(board))
+				benchmark::DoNotOptimize(board);
+		}
+		std::remove(filename.c_str());
+		state.SetItemsProcessed(state.iterations() * FILE_REPEAT * PUZZLE_COUNT);
+	}
+}
+
+BENCHMARK_CAPTURE(BM_Solve, Backtracking/Easy, Sudoku::BACKTRACKING, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_Solve, Backtracking/Hard, Sudoku::BACKTRACKING, BenchmarkCorpus::HARD);
+BENCHMARK_CAPTURE(BM_Solve, Backtracking/17Clue, Sudoku::BACKTRACKING, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK_CAPTURE(BM_Solve, Bitboard/Easy, Sudoku::BITBOARD, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_Solve, Bitboard/Hard, Sudoku::BITBOARD, BenchmarkCorpus::HARD);
+BENCHMARK_CAPTURE(BM_Solve, Bitboard/17Clue, Sudoku::BITBOARD, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK_CAPTURE(BM_Solve, DancingLinks/Easy, Sudoku::DANCING_LINKS, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_Solve, DancingLinks/Hard, Sudoku::DANCING_LINKS, BenchmarkCorpus::HARD);
+BENCHMARK_CAPTURE(BM_Solve, DancingLinks/17Clue, Sudoku::DANCING_LINKS, BenchmarkCorpus::SEVENTEEN_CLUE);
+
+BENCHMARK_CAPTURE(BM_Canonicalize, Easy, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_Canonicalize, Hard, BenchmarkCorpus::HARD);
+BENCHMARK_CAPTURE(BM_Canonicalize, 17Clue, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK_CAPTURE(BM_SolveCached, Hard/Hits, BenchmarkCorpus::HARD, true);
+BENCHMARK_CAPTURE(BM_SolveCached, Hard/Misses, BenchmarkCorpus::HARD, false);
+
+BENCHMARK_CAPTURE(BM_Generate, Easy, Sudoku::EASY, false);
+BENCHMARK_CAPTURE(BM_Generate, Medium, Sudoku::MEDIUM, false);
+BENCHMARK_CAPTURE(BM_Generate, Hard, Sudoku::HARD, false);
+BENCHMARK_CAPTURE(BM_Generate, Easy/Unique, Sudoku::EASY, true)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generate, Medium/Unique, Sudoku::MEDIUM, true)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Generate, Hard/Unique, Sudoku::HARD, true)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_IsValid, Easy, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_IsValid, 17Clue, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK_CAPTURE(BM_IsValidMap, Easy, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_IsValidMap, 17Clue, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK_CAPTURE(BM_IsValidIndexBoard, Easy, BenchmarkCorpus::EASY);
+BENCHMARK_CAPTURE(BM_IsValidIndexBoard, 17Clue, BenchmarkCorpus::SEVENTEEN_CLUE);
+BENCHMARK(BM_IsValidArray);
+BENCHMARK(BM_IsValidBatch);
+BENCHMARK_CAPTURE(BM_UnitSets, Map, mapMarks);
+BENCHMARK_CAPTURE(BM_UnitSets, KeyIndex, tableMarks);
+BENCHMARK(BM_UnitSetsIndexBoard);
+BENCHMARK(BM_MarkedBoard);
+BENCHMARK(BM_IsSolved);
+BENCHMARK(BM_IsSolvedReport);
+
+BENCHMARK_CAPTURE(BM_SaveLoadFile, Grid, FileIO::GRID);
+BENCHMARK_CAPTURE(BM_SaveLoadFile, Line, FileIO::LINE);
+BENCHMARK(BM_ParseLines);
+BENCHMARK(BM_MappedRead);
+BENCHMARK(BM_BinaryWriteRead);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "../Sudoku/Batch/BatchSolver.hpp"
+#include "../Sudoku/Batch/BatchSolver.cpp"
+#include "../Sudoku/Batch/WorkStealingPool.hpp"
+#include "../Sudoku/Batch/WorkStealingPool.cpp"
+#include "../Sudoku/Checker/SudokuChecker.hpp"
+#include "../Sudoku/FileIO/FileIO.hpp"
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "Constants.hpp"
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+class BatchSolverTest : public ::testing::Test {
+protected:
+	Sudoku::SudokuChecker checker;
+	int correct_values, incorrect_values, empty_cells;
+
+	void SetUp() override {
+		Sudoku::Board valid(TestConstants::valid_matrix);
+		Sudoku::Board impossible(TestConstants::impossible_matrix);
+		Sudoku::Board row_invalid(TestConstants::row_invalid_matrix);
+		FileIO::writeLine(input, valid);
+		FileIO::writeLine(input, impossible);
+		input << "not a board\n\n";
+		FileIO::writeLine(input, row_invalid);
+		FileIO::writeLine(input, valid);
+	}
+
+	std::stringstream input;
+};
+
+TEST_F(BatchSolverTest, Solve) {
+	Sudoku::BatchSolver batch_solver;
+	std::stringstream output;
+	Sudoku::BatchResult result = batch_solver.solve(input, output);
+	ASSERT_EQ(result.puzzles, 5);
+	ASSERT_EQ(result.solved, 2);
+	ASSERT_EQ(result.unsolvable, 1);
+	ASSERT_EQ(result.invalid, 2);
+	// invalid boards are rejected before they reach the solver
+	ASSERT_EQ(result.stats.solves, 3);
+	ASSERT_GT(result.stats.nodes, 0);
+	ASSERT_GE(result.stats.time, result.stats.max_time);
+
+	// one output line per input line
+	std::string line;
+	std::vector<std::string> lines;
+	while(std::getline(output, line))
+		lines.push_back(line);
+	ASSERT_EQ(lines.size(), 6);
+	ASSERT_EQ(lines[2], "not a board");
+	ASSERT_EQ(lines[3], "");
+
+	Sudoku::Board start_board(TestConstants::valid_matrix);
+	Sudoku::Board board;
+	for(int idx : {0, 5}){
+		FileIO::parseLine(lines[idx], board);
+		ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	}
+}
+
+TEST_F(BatchSolverTest, SolveEngines) {
+	for(Sudoku::SolverEngine engine : {Sudoku::BITBOARD, Sudoku::DANCING_LINKS}){
+		Sudoku::BatchSolver batch_solver(engine);
+		std::stringstream in(input.str()), output;
+		Sudoku::BatchResult result = batch_solver.solve(in, output);
+		ASSERT_EQ(result.solved, 2);
+		ASSERT_EQ(result.unsolvable, 1);
+		ASSERT_EQ(result.invalid, 2);
+	}
+}
+
+TEST_F(BatchSolverTest, ParallelOrdered) {
+	std::string block = input.str();
+	std::string text;
+	for(int _=0; _<2000; _++)
+		text += block;
+
+	Sudoku::BatchSolver sequential;
+	std::stringstream in(text), expected;
+	Sudoku::BatchResult expected_result = sequential.solve(in, expected);
+
+	Sudoku::BatchSolver parallel(Sudoku::BACKTRACKING, 4, true);
+	ASSERT_EQ(parallel.getThreadCount(), 4);
+	std::stringstream in2(text), output;
+	Sudoku::BatchResult result = parallel.solve(in2, output);
+	ASSERT_EQ(result.puzzles, expected_result.puzzles);
+	ASSERT_EQ(result.solved, expected_result.solved);
+	ASSERT_EQ(result.unsolvable, expected_result.unsolvable);
+	ASSERT_EQ(result.invalid, expected_result.invalid);
+	ASSERT_EQ(result.stats.solves, expected_result.stats.solves);
+	ASSERT_EQ(result.stats.nodes, expected_result.stats.nodes);
+	ASSERT_EQ(result.stats.backtracks, expected_result.stats.backtracks);
+	ASSERT_EQ(output.str(), expected.str());
+}
+
+TEST_F(BatchSolverTest, ParallelUnordered) {
+	std::string block = input.str();
+	std::string text;
+	for(int _=0; _<2000; _++)
+		text += block;
+
+	Sudoku::BatchSolver sequential(Sudoku::BITBOARD);
+	std::stringstream in(text), expected;
+	sequential.solve(in, expected);
+
+	Sudoku::BatchSolver parallel(Sudoku::BITBOARD, 3, false);
+	std::stringstream in2(text), output;
+	Sudoku::BatchResult result = parallel.solve(in2, output);
+	ASSERT_EQ(result.solved, 2*2000);
+
+	auto sortedLines = [](std::stringstream& stream){
+		std::vector<std::string> lines;
+		std::string line;
+		while(std::getline(stream, line))
+			lines.push_back(line);
+		std::sort(lines.begin(), lines.end());
+		return lines;
+	};
+	ASSERT_EQ(sortedLines(output), sortedLines(expected));
+}
+
+TEST(WorkStealingPoolTest, EveryTaskOnce) {
+	Sudoku::WorkStealingPool pool(4);
+	std::vector<std::atomic<int>> runs(1000);
+	for(std::atomic<int>& r : runs)
+		r = 0;
+	pool.run(static_cast<int>(runs.size()), [&](int worker, int task){
+		ASSERT_GE(worker, 0);
+		ASSERT_LT(worker, 4);
+		runs[task]++;
+	});
+	for(std::atomic<int>& r : runs)
+		ASSERT_EQ(r, 1);
+	pool.run(0, [](int, int){});
+}
+
+TEST_F(BatchSolverTest, MappedFile) {
+	const char* path = "tmp_batch.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << input.str();
+	}
+	std::stringstream expected;
+	Sudoku::BatchSolver().solve(input, expected);
+
+	for(int threads : {1, 2}){
+		FileIO::MappedPuzzleReader reader(path);
+		Sudoku::BatchSolver batch_solver(Sudoku::BACKTRACKING, threads, true);
+		std::stringstream output;
+		Sudoku::BatchResult result = batch_solver.solve(reader, output);
+		ASSERT_EQ(result.puzzles, 5);
+		ASSERT_EQ(output.str(), expected.str());
+	}
+	std::remove(path);
+}
@@ -112,4 +112,17 @@ namespace TestConstants{
 			{' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '},
 			{' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '},
 	};
+
+	// 17 clue puzzle with a unique solution that is slow for row-major backtracking
+	const char hard_matrix[BOARD_SIZE][BOARD_SIZE] ={
+			{' ', ' ', ' ', ' ', ' ', ' ', ' ', '1', ' '},
+			{'4', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '},
+			{' ', '2', ' ', ' ', ' ', ' ', ' ', ' ', ' '},
+			{' ', ' ', ' ', ' ', '5', ' ', '4', ' ', '7'},
+			{' ', ' ', '8', ' ', ' ', ' ', '3', ' ', ' '},
+			{' ', ' ', '1', ' ', '9', ' ', ' ', ' ', ' '},
+			{'3', ' ', ' ', '4', ' ', ' ', '2', ' ', ' '},
+			{' ', '5', ' ', '1', ' ', ' ', ' ', ' ', ' '},
+			{' ', ' ', ' ', '8', ' ', '6', ' ', ' ', ' '},
+	};
 }
\ No newline at end of file
@@ -2,8 +2,15 @@
 #include "../Sudoku/Sudoku/Board.hpp"
 #include "../Sudoku/FileIO/FileIO.hpp"
 #include "../Sudoku/FileIO/FileIO.cpp"
+#include "../Sudoku/FileIO/MappedPuzzleReader.hpp"
+#include "../Sudoku/FileIO/MappedPuzzleReader.cpp"
+#include "../Sudoku/FileIO/BinaryFormat.hpp"
+#include "../Sudoku/FileIO/BinaryFormat.cpp"
 #include "Constants.hpp"
 #include <cstdio>
+#include <sstream>
+#include <fstream>
+#include <string>
 
 class FileIOTest : public ::testing::Test {
 protected:
@@ -30,4 +37,190 @@ TEST_F(FileIOTest, InputOutputTest) {
 			ASSERT_EQ(board[i][j], board2[i][j]);
 		}
 	}
-}
\ No newline at end of file
+}
+
+TEST_F(FileIOTest, LineInputOutputTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	std::stringstream stream;
+	FileIO::writeLine(stream, board);
+	FileIO::writeLine(stream, board);
+
+	Sudoku::Board board2;
+	for(int _=0; _<2; _++){
+		ASSERT_TRUE(FileIO::readLine(stream, board2));
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ(board[i][j], board2[i][j]);
+			}
+		}
+	}
+	ASSERT_FALSE(FileIO::readLine(stream, board2));
+}
+
+TEST_F(FileIOTest, InvalidLineTest) {
+	Sudoku::Board board;
+	ASSERT_THROW(FileIO::parseLine("123", board), std::invalid_argument);
+	ASSERT_THROW(FileIO::parseLine(std::string(BOARD_SIZE*BOARD_SIZE - 1, '.') + "x", board), std::invalid_argument);
+	ASSERT_NO_THROW(FileIO::parseLine(std::string(BOARD_SIZE*BOARD_SIZE, '0'), board));
+	ASSERT_EQ(board[0][0], Constants::EMPTY_CELL);
+}
+
+TEST_F(FileIOTest, LineFileTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	FileIO::saveToFile(path, board, FileIO::LINE);
+
+	std::ifstream in(path);
+	std::string line;
+	std::getline(in, line);
+	ASSERT_EQ(line.size(), BOARD_SIZE*BOARD_SIZE);
+	in.close();
+
+	Sudoku::Board board2;
+	FileIO::loadFromFile(path, board2);
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board[i][j], board2[i][j]);
+		}
+	}
+}
+
+TEST_F(FileIOTest, DetectFormatTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	std::stringstream grid, line;
+	grid << board;
+	FileIO::writeLine(line, board);
+	ASSERT_EQ(FileIO::detectFormat(grid), FileIO::GRID);
+	ASSERT_EQ(FileIO::detectFormat(line), FileIO::LINE);
+}
+
+TEST_F(FileIOTest, MappedReaderTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	{
+		std::ofstream out(path, std::ios::binary);
+		FileIO::writeLine(out, board);
+		out << "\r\n";
+		FileIO::writeLine(out, board);
+		out << "not a board";
+	}
+
+	FileIO::MappedPuzzleReader reader(path);
+	Sudoku::Board board2;
+	for(int _=0; _<2; _++){
+		ASSERT_TRUE(reader.next(board2));
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ(board[i][j], board2[i][j]);
+			}
+		}
+	}
+	ASSERT_THROW(reader.next(board2), std::invalid_argument);
+	ASSERT_FALSE(reader.next(board2));
+
+	reader.rewind();
+	const char* line;
+	size_t length;
+	int line_cnt = 0;
+	while(reader.nextLine(line, length))
+		line_cnt++;
+	ASSERT_EQ(line_cnt, 4);
+}
+
+TEST_F(FileIOTest, BinaryRecordTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	uint8_t record[FileIO::Binary::RECORD_SIZE];
+	FileIO::Binary::pack(board, record);
+	Sudoku::Board board2;
+	FileIO::Binary::unpack(record, board2);
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board[i][j], board2[i][j]);
+		}
+	}
+	record[0] = 0xFF;
+	ASSERT_THROW(FileIO::Binary::unpack(record, board2), std::invalid_argument);
+
+	// a character outside of the alphabet has no nibble
+	board2[4][4] = '?';
+	ASSERT_THROW(FileIO::Binary::pack(board2, record), std::invalid_argument);
+}
+
+TEST_F(FileIOTest, BinaryFileTest) {
+	Sudoku::Board boards[3] = {
+		Sudoku::Board(TestConstants::valid_matrix),
+		Sudoku::Board(TestConstants::solution_matrix),
+		Sudoku::Board(TestConstants::hard_matrix)
+	};
+	{
+		FileIO::BinaryPuzzleWriter writer(path);
+		for(const Sudoku::Board& board : boards)
+			writer.write(board);
+	}
+	ASSERT_TRUE(FileIO::isBinaryFile(path));
+
+	FileIO::BinaryPuzzleReader reader(path);
+	ASSERT_EQ(reader.size(), 3);
+	Sudoku::Board board;
+	for(int idx : {2, 0, 1}){
+		reader.read(idx, board);
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ(boards[idx][i][j], board[i][j]);
+			}
+		}
+	}
+	reader.seek(1);
+	ASSERT_TRUE(reader.next(board));
+	ASSERT_TRUE(reader.next(board));
+	ASSERT_FALSE(reader.next(board));
+	ASSERT_THROW(reader.read(3, board), std::out_of_range);
+
+#ifdef __linux__
+	// every write to /dev/full fails once the buffer is flushed
+	FileIO::BinaryPuzzleWriter full("/dev/full");
+	full.write(boards[0]);
+	ASSERT_THROW(full.close(), std::runtime_error);
+#endif
+}
+
+TEST_F(FileIOTest, BinaryConvertTest) {
+	const char* text_path = "tmp_boards.txt";
+	const char* text_path2 = "tmp_boards2.txt";
+	Sudoku::Board grid_board(TestConstants::valid_matrix);
+	Sudoku::Board line_board(TestConstants::hard_matrix);
+	{
+		std::ofstream out(text_path);
+		out << grid_board << grid_board;
+		FileIO::writeLine(out, line_board);
+	}
+	ASSERT_FALSE(FileIO::isBinaryFile(text_path));
+	ASSERT_EQ(FileIO::textToBinary(text_path, path), 3);
+	ASSERT_EQ(FileIO::binaryToText(path, text_path2, FileIO::LINE), 3);
+
+	FileIO::MappedPuzzleReader reader(text_path2);
+	Sudoku::Board board;
+	for(const Sudoku::Board* expected : {&grid_board, &grid_board, &line_board}){
+		ASSERT_TRUE(reader.next(board));
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ((*expected)[i][j], board[i][j]);
+			}
+		}
+	}
+	ASSERT_FALSE(reader.next(board));
+	std::remove(text_path);
+	std::remove(text_path2);
+}
+
+TEST_F(FileIOTest, BinarySaveLoadTest) {
+	Sudoku::Board board(TestConstants::valid_matrix);
+	FileIO::saveToFile(path, board, FileIO::BINARY);
+	ASSERT_TRUE(FileIO::isBinaryFile(path));
+
+	Sudoku::Board board2;
+	FileIO::loadFromFile(path, board2);
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board[i][j], board2[i][j]);
+		}
+	}
+}
@@ -0,0 +1,288 @@
+#include "pch.h"
+#include "../Sudoku/Server/RequestServer.hpp"
+#include "../Sudoku/Server/RequestServer.cpp"
+#include "../Sudoku/Engine/SudokuEngine.hpp"
+#include "../Sudoku/FileIO/FileIO.hpp"
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "Constants.hpp"
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+class RequestServerTest : public ::testing::Test {
+protected:
+	Server::RequestServer server{Sudoku::DANCING_LINKS, 2};
+
+	static std::string line(const Sudoku::Board& board){
+		std::ostringstream out;
+		FileIO::writeLine(out, board);
+		std::string result = out.str();
+		result.pop_back();
+		return result;
+	}
+
+	static std::string line(const char matrix[Constants::BOARD_SIZE][Constants::BOARD_SIZE]){
+		return line(Sudoku::Board(matrix));
+	}
+
+	std::vector<std::string> serve(const std::string& requests, Server::ServerStats& stats){
+		std::istringstream in(requests);
+		std::ostringstream out;
+		stats = server.serve(in, out);
+		std::vector<std::string> replies;
+		std::istringstream reply_stream(out.str());
+		std::string reply;
+		while(std::getline(reply_stream, reply))
+			replies.push_back(reply);
+		return replies;
+	}
+
+#ifndef _WIN32
+	static int connectSocket(const std::string& path){
+		sockaddr_un address = {};
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		// the listener may not be bound yet
+		for(int attempt=0; attempt<200; attempt++){
+			if(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+				return fd;
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		::close(fd);
+		return -1;
+	}
+
+	static std::string request(int fd, const std::string& lines, size_t reply_cnt){
+		EXPECT_EQ(::write(fd, lines.data(), lines.size()), static_cast<ssize_t>(lines.size()));
+		std::string replies;
+		char buffer[256];
+		while(std::count(replies.begin(), replies.end(), '\n') < static_cast<long>(reply_cnt)){
+			ssize_t n = ::read(fd, buffer, sizeof(buffer));
+			if(n <= 0)
+				break;
+			replies.append(buffer, n);
+		}
+		return replies;
+	}
+
+	static int openDescriptors(){
+		int count = 0;
+		for(int fd=0; fd<4096; fd++){
+			if(::fcntl(fd, F_GETFD) != -1)
+				count++;
+		}
+		return count;
+	}
+#endif
+};
+
+TEST_F(RequestServerTest, Requests) {
+	std::string valid = line(TestConstants::valid_matrix);
+	std::string requests =
+		"1 ping\n"
+		"2 valid " + valid + "\n"
+		"3 valid " + line(TestConstants::row_invalid_matrix) + "\n"
+		"\r\n"
+		"4 solve " + line(TestConstants::impossible_matrix) + "\n"
+		"5 solve " + line(TestConstants::row_invalid_matrix) + "\n"
+		"6 count " + line(TestConstants::hard_matrix) + "\n"
+		"7 count " + line(Sudoku::Board()) + " 5\n"
+		"8 check " + valid + " " + line(TestConstants::missing_matrix) + "\n"
+		"9 grade " + line(TestConstants::hard_matrix) + "\n"
+		"10 solve\n"
+		"11 count " + valid + " 0\n"
+		"12 generate x\n"
+		"13 fly\n"
+		"14\n"
+		"15 solve " + valid + "\r\n";
+	Server::ServerStats stats;
+	std::vector<std::string> replies = serve(requests, stats);
+	ASSERT_EQ(replies.size(), 15);
+	ASSERT_EQ(replies[0], "1 pong");
+	ASSERT_EQ(replies[1], "2 valid");
+	ASSERT_EQ(replies[2], "3 invalid");
+	ASSERT_EQ(replies[3], "4 unsolvable");
+	ASSERT_EQ(replies[4], "5 invalid");
+	ASSERT_EQ(replies[5], "6 count 1");
+	ASSERT_EQ(replies[6], "7 count 5");
+	ASSERT_EQ(replies[7].compare(0, 10, "8 unsolved"), 0);
+	Sudoku::GradeReport report = Sudoku::TechniqueGrader().grade(Sudoku::Board(TestConstants::hard_matrix));
+	ASSERT_EQ(replies[8].compare(0, 8, "9 grade "), 0);
+	ASSERT_EQ(replies[8].substr(replies[8].rfind(' ') + 1), std::to_string(report.score));
+	for(int i=9; i<14; i++)
+		ASSERT_EQ(replies[i].compare(0, std::to_string(i + 1).size() + 7, std::to_string(i + 1) + " error "), 0) << replies[i];
+
+	// the solution of a solve request passes a check request against its puzzle
+	ASSERT_EQ(replies[14].compare(0, 10, "15 solved "), 0);
+	std::string solution = replies[14].substr(10);
+	Sudoku::Board solved;
+	FileIO::parseLine(solution, solved);
+	ASSERT_EQ(serve("16 check " + valid + " " + solution + "\n", stats)[0], "16 solved");
+
+	ASSERT_EQ(stats.connections, 1);
+	ASSERT_EQ(stats.requests, 1);
+	ASSERT_EQ(stats.errors, 0);
+}
+
+TEST_F(RequestServerTest, LongLine) {
+	Server::ServerStats stats;
+	std::vector<std::string> replies = serve("a solve " + std::string(Server::RequestServer::MAX_LINE, '.') + "\nb ping\n", stats);
+	ASSERT_EQ(replies.size(), 2);
+	ASSERT_EQ(replies[0], "a error line too long");
+	ASSERT_EQ(replies[1], "b pong");
+	ASSERT_EQ(stats.requests, 2);
+	ASSERT_EQ(stats.errors, 1);
+}
+
+TEST_F(RequestServerTest, Generate) {
+	Server::ServerStats stats;
+	std::vector<std::string> replies = serve("a generate h unique 42\nb generate e 7\nc generate h 42 unique\nd generate m\n", stats);
+	ASSERT_EQ(replies.size(), 4);
+
+	// a seeded request generates the board the engine generates from the seed
+	Sudoku::SudokuEngine engine;
+	engine.setSolverEngine(Sudoku::DANCING_LINKS);
+	engine.setDifficulty(Sudoku::HARD);
+	engine.setUnique(true);
+	Sudoku::Board board;
+	engine.generate(board, 42);
+	ASSERT_EQ(replies[0], "a board " + line(board));
+	ASSERT_EQ(replies[2], "c board " + line(board));
+	engine.setDifficulty(Sudoku::EASY);
+	engine.setUnique(false);
+	engine.generate(board, 7);
+	ASSERT_EQ(replies[1], "b board " + line(board));
+
+	ASSERT_EQ(replies[3].compare(0, 8, "d board "), 0);
+	FileIO::parseLine(replies[3].substr(8), board);
+	ASSERT_TRUE(engine.isValid(board));
+}
+
+TEST_F(RequestServerTest, Budget) {
+	server.setNodeLimit(1);
+	std::string hard = line(TestConstants::hard_matrix);
+	Server::ServerStats stats;
+	std::vector<std::string> replies = serve("1 solve " + hard + "\n2 count " + hard + "\n", stats);
+	ASSERT_EQ(replies.size(), 2);
+	ASSERT_EQ(replies[0], "1 error budget");
+	ASSERT_EQ(replies[1], "2 error budget");
+	ASSERT_EQ(stats.errors, 2);
+
+	server.setNodeLimit(Server::RequestServer::DEFAULT_NODE_LIMIT);
+	replies = serve("3 solve " + hard + "\n4 count " + hard + "\n", stats);
+	ASSERT_EQ(replies[0].compare(0, 9, "3 solved "), 0);
+	ASSERT_EQ(replies[1], "4 count 1");
+}
+
+TEST_F(RequestServerTest, Shutdown) {
+	Server::ServerStats stats;
+	std::vector<std::string> replies = serve("1 ping\n2 shutdown\n3 ping\n", stats);
+	ASSERT_GE(replies.size(), 2);
+	ASSERT_EQ(replies[0], "1 pong");
+	ASSERT_EQ(replies[1], "2 bye");
+	// a request read before the shutdown was processed may still be answered in its batch
+	ASSERT_LE(replies.size(), 3);
+
+	// the server can serve again after a shutdown
+	replies = serve("4 ping\n", stats);
+	ASSERT_EQ(replies.size(), 1);
+	ASSERT_EQ(replies[0], "4 pong");
+}
+
+#ifndef _WIN32
+TEST_F(RequestServerTest, Socket) {
+	std::string path = "request_server_test_" + std::to_string(::getpid()) + ".sock";
+	Server::ServerStats stats;
+	std::thread listener([&]{ stats = server.serveSocket(path); });
+
+	int first = connectSocket(path);
+	ASSERT_GE(first, 0);
+	int second = connectSocket(path);
+	ASSERT_GE(second, 0);
+	ASSERT_EQ(request(first, "a ping\nb solve " + line(TestConstants::impossible_matrix) + "\n", 2), "a pong\nb unsolvable\n");
+	ASSERT_EQ(request(second, "c valid " + line(TestConstants::valid_matrix) + "\n", 1), "c valid\n");
+	ASSERT_EQ(request(second, "d shutdown\n", 1), "d bye\n");
+	listener.join();
+	::close(first);
+	::close(second);
+
+	ASSERT_EQ(stats.connections, 2);
+	ASSERT_EQ(stats.requests, 4);
+	ASSERT_NE(::access(path.c_str(), F_OK), 0);
+}
+
+TEST_F(RequestServerTest, SocketReconnect) {
+	std::string path = "request_server_reconnect_" + std::to_string(::getpid()) + ".sock";
+	Server::ServerStats stats;
+	std::thread listener([&]{ stats = server.serveSocket(path); });
+
+	auto session = [&](int id){
+		int fd = connectSocket(path);
+		ASSERT_GE(fd, 0);
+		std::string ping = std::to_string(id) + " ping\n";
+		ASSERT_EQ(request(fd, ping, 1), std::to_string(id) + " pong\n");
+		::close(fd);
+	};
+	// the server closes a client that left within one poll of its listener
+	session(0);
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	int baseline = openDescriptors();
+	for(int i=1; i<=300; i++)
+		session(i);
+	for(int attempt=0; attempt<100 && openDescriptors() != baseline; attempt++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_EQ(openDescriptors(), baseline);
+
+	int fd = connectSocket(path);
+	ASSERT_EQ(request(fd, "last shutdown\n", 1), "last bye\n");
+	listener.join();
+	::close(fd);
+	ASSERT_EQ(stats.connections, 302);
+	ASSERT_EQ(stats.requests, 302);
+}
+
+TEST_F(RequestServerTest, SlowClient) {
+	std::string path = "request_server_slow_" + std::to_string(::getpid()) + ".sock";
+	Server::ServerStats stats;
+	std::thread listener([&]{ stats = server.serveSocket(path); });
+
+	// the replies of the first client outgrow its socket buffer and its outbox, it never reads them
+	int slow = connectSocket(path);
+	ASSERT_GE(slow, 0);
+	std::string lines;
+	for(int i=0; i<2000; i++)
+		lines += std::string(1000, 'a') + std::to_string(i) + " ping\n";
+	// the server disconnects the client once its outbox is full, so only part of the requests may get through
+	size_t written = 0;
+	while(written < lines.size()){
+		ssize_t n = ::send(slow, lines.data() + written, lines.size() - written, MSG_NOSIGNAL);
+		if(n <= 0)
+			break;
+		written += static_cast<size_t>(n);
+	}
+	ASSERT_GT(written, static_cast<size_t>(Server::RequestServer::MAX_OUTBOX));
+
+	int fast = connectSocket(path);
+	ASSERT_GE(fast, 0);
+	timeval timeout = {10, 0};
+	::setsockopt(fast, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	ASSERT_EQ(request(fast, "b ping\n", 1), "b pong\n");
+	ASSERT_EQ(request(fast, "c shutdown\n", 1), "c bye\n");
+	listener.join();
+	::close(slow);
+	::close(fast);
+	ASSERT_EQ(stats.connections, 2);
+}
+#endif
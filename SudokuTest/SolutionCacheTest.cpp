@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "../Sudoku/Solver/SolutionCache.hpp"
+#include "../Sudoku/Solver/SolutionCache.cpp"
+#include "../Sudoku/Sudoku/CanonicalForm.hpp"
+#include "../Sudoku/Sudoku/CanonicalForm.cpp"
+#include "../Sudoku/Solver/SudokuSolver.hpp"
+#include "../Sudoku/Engine/SudokuEngine.hpp"
+#include "../Sudoku/Checker/SudokuChecker.hpp"
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "../Sudoku/Sudoku/MarkedBoard.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+class SolutionCacheTest : public ::testing::Test {
+protected:
+	std::mt19937 generator{42};
+
+	static bool sameBoard(const Sudoku::Board& a, const Sudoku::Board& b){
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(a[i][j] != b[i][j])
+					return false;
+			}
+		}
+		return true;
+	}
+
+	Sudoku::BoardTransform randomTransform(){
+		Sudoku::BoardTransform transform;
+		transform.transposed = generator() % 2 == 1;
+		uint8_t bands[3] = {0, 1, 2}, stacks[3] = {0, 1, 2};
+		std::shuffle(bands, bands + 3, generator);
+		std::shuffle(stacks, stacks + 3, generator);
+		for(int b=0; b<3; b++){
+			uint8_t rows[3] = {0, 1, 2}, cols[3] = {0, 1, 2};
+			std::shuffle(rows, rows + 3, generator);
+			std::shuffle(cols, cols + 3, generator);
+			for(int k=0; k<3; k++){
+				transform.rows[b*3 + k] = static_cast<uint8_t>(bands[b]*3 + rows[k]);
+				transform.cols[b*3 + k] = static_cast<uint8_t>(stacks[b]*3 + cols[k]);
+			}
+		}
+		std::iota(transform.values, transform.values + Constants::BOARD_SIZE, 0);
+		std::shuffle(transform.values, transform.values + Constants::BOARD_SIZE, generator);
+		return transform;
+	}
+};
+
+TEST_F(SolutionCacheTest, TransformRoundTrip) {
+	Sudoku::Board board(TestConstants::hard_matrix), transformed, reverted;
+	for(int i=0; i<20; i++){
+		Sudoku::BoardTransform transform = randomTransform();
+		transform.apply(board, transformed);
+		transform.revert(transformed, reverted);
+		ASSERT_TRUE(sameBoard(reverted, board));
+	}
+}
+
+TEST_F(SolutionCacheTest, CanonicalInvariance) {
+	Sudoku::CanonicalForm canonical_form;
+	const char (*matrices[])[Constants::BOARD_SIZE] = {TestConstants::valid_matrix, TestConstants::hard_matrix, TestConstants::impossible_matrix};
+	for(auto matrix : matrices){
+		Sudoku::Board board(matrix), canonical, transformed, other;
+		Sudoku::BoardTransform transform;
+		ASSERT_TRUE(canonical_form.canonicalize(board, canonical, transform));
+		// the transform that is returned turns the board into its canonical form
+		transform.apply(board, transformed);
+		ASSERT_TRUE(sameBoard(transformed, canonical));
+		for(int i=0; i<20; i++){
+			randomTransform().apply(board, transformed);
+			ASSERT_TRUE(canonical_form.canonicalize(transformed, other, transform));
+			ASSERT_TRUE(sameBoard(other, canonical));
+		}
+	}
+
+	// full grids tie too often, a board outside of the alphabet has no canonical form
+	Sudoku::Board canonical, board(TestConstants::valid_matrix), solution(TestConstants::solution_matrix), transformed;
+	Sudoku::BoardTransform transform;
+	ASSERT_FALSE(canonical_form.canonicalize(solution, canonical, transform));
+	randomTransform().apply(solution, transformed);
+	ASSERT_FALSE(canonical_form.canonicalize(transformed, canonical, transform));
+	board[0][0] = '?';
+	ASSERT_FALSE(canonical_form.canonicalize(board, canonical, transform));
+}
+
+TEST_F(SolutionCacheTest, LeastRecentlyUsed) {
+	ASSERT_THROW(Sudoku::SolutionCache(0), std::invalid_argument);
+	Sudoku::SolutionCache cache(2);
+	Sudoku::Board first(TestConstants::valid_matrix), second(TestConstants::hard_matrix), third(TestConstants::impossible_matrix);
+	Sudoku::Board solution(TestConstants::solution_matrix), found;
+	bool solvable = false;
+	ASSERT_FALSE(cache.find(first, found, solvable));
+	cache.insert(first, solution, true);
+	cache.insert(second, solution, true);
+	ASSERT_EQ(cache.size(), 2);
+
+	// the lookup makes the first puzzle the most recently used one, so the second is dropped
+	ASSERT_TRUE(cache.find(first, found, solvable));
+	ASSERT_TRUE(solvable);
+	ASSERT_TRUE(sameBoard(found, solution));
+	cache.insert(third, solution, false);
+	ASSERT_EQ(cache.size(), 2);
+	ASSERT_FALSE(cache.find(second, found, solvable));
+	ASSERT_TRUE(cache.find(third, found, solvable));
+	ASSERT_FALSE(solvable);
+	ASSERT_TRUE(cache.find(first, found, solvable));
+
+	cache.clear();
+	ASSERT_EQ(cache.size(), 0);
+	ASSERT_FALSE(cache.find(first, found, solvable));
+}
+
+TEST_F(SolutionCacheTest, Solver) {
+	Sudoku::SolutionCache cache(16);
+	Sudoku::SudokuSolver solver(Sudoku::DANCING_LINKS);
+	solver.setSolutionCache(&cache);
+	Sudoku::SudokuChecker checker;
+	int correct_values, incorrect_values, empty_cells;
+	Sudoku::Board puzzle(TestConstants::hard_matrix), transformed;
+	Sudoku::MarkedBoard solution;
+	Sudoku::SolverStats stats;
+	ASSERT_TRUE(solver.solve(puzzle, solution, stats));
+	ASSERT_EQ(stats.cache_hits, 0);
+	ASSERT_EQ(cache.size(), 1);
+
+	// a transformed puzzle is answered from the cache with its own solution
+	for(int i=0; i<10; i++){
+		randomTransform().apply(puzzle, transformed);
+		ASSERT_TRUE(solver.solve(transformed, solution, stats));
+		ASSERT_TRUE(checker.isSolved(solution, transformed, correct_values, incorrect_values, empty_cells));
+	}
+	ASSERT_EQ(stats.cache_hits, 10);
+	ASSERT_EQ(stats.solves, 11);
+
+	// unsolvable puzzles are cached as well
+	Sudoku::Board impossible(TestConstants::impossible_matrix);
+	ASSERT_FALSE(solver.solve(impossible, solution, stats));
+	randomTransform().apply(impossible, transformed);
+	ASSERT_FALSE(solver.solve(transformed, solution, stats));
+	ASSERT_EQ(stats.cache_hits, 11);
+	ASSERT_EQ(cache.size(), 2);
+
+	// the count that proves a bitboard solution unique is left out of the stats of the solve
+	Sudoku::SudokuSolver plain(Sudoku::BITBOARD), cached(Sudoku::BITBOARD);
+	Sudoku::SolutionCache bitboard_cache(16);
+	cached.setSolutionCache(&bitboard_cache);
+	Sudoku::SolverStats plain_stats, cached_stats;
+	ASSERT_TRUE(plain.solve(puzzle, solution, plain_stats));
+	ASSERT_TRUE(cached.solve(puzzle, solution, cached_stats));
+	ASSERT_EQ(cached_stats.nodes, plain_stats.nodes);
+	ASSERT_EQ(bitboard_cache.size(), 1);
+}
+
+TEST_F(SolutionCacheTest, MultipleSolutions) {
+	Sudoku::SolutionCache cache(16);
+	Sudoku::SudokuSolver solver(Sudoku::DANCING_LINKS);
+	solver.setSolutionCache(&cache);
+	Sudoku::SudokuChecker checker;
+	int correct_values, incorrect_values, empty_cells;
+	Sudoku::DancingLinks dancing_links;
+	Sudoku::Board puzzle(TestConstants::valid_matrix), transformed, canonical;
+	ASSERT_EQ(dancing_links.countSolutions(puzzle, 2), 2);
+	Sudoku::BoardTransform transform;
+	ASSERT_TRUE(Sudoku::CanonicalForm().canonicalize(puzzle, canonical, transform));
+
+	// a cached solution would be whichever one was found first, so every copy is searched
+	Sudoku::MarkedBoard solution;
+	Sudoku::SolverStats stats;
+	ASSERT_TRUE(solver.solve(puzzle, solution, stats));
+	ASSERT_TRUE(checker.isSolved(solution, puzzle, correct_values, incorrect_values, empty_cells));
+	for(int i=0; i<5; i++){
+		randomTransform().apply(puzzle, transformed);
+		ASSERT_TRUE(solver.solve(transformed, solution, stats));
+		ASSERT_TRUE(checker.isSolved(solution, transformed, correct_values, incorrect_values, empty_cells));
+	}
+	ASSERT_EQ(stats.cache_hits, 0);
+	ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(SolutionCacheTest, Engine) {
+	Sudoku::SudokuEngine engine(2);
+	engine.setSolverEngine(Sudoku::DANCING_LINKS);
+	ASSERT_EQ(engine.getCacheCapacity(), 0);
+	engine.setCacheCapacity(8);
+	ASSERT_EQ(engine.getCacheCapacity(), 8);
+
+	const int count = 16;
+	Sudoku::Board puzzles[count], solutions[count];
+	Sudoku::SolveStatus statuses[count];
+	Sudoku::Board puzzle(TestConstants::hard_matrix);
+	for(int i=0; i<count; i++)
+		randomTransform().apply(puzzle, puzzles[i]);
+	Sudoku::SolverStats stats;
+	ASSERT_EQ(engine.solve(puzzles, count, solutions, statuses, &stats), count);
+	for(int i=0; i<count; i++){
+		ASSERT_EQ(statuses[i], Sudoku::SOLVE_SOLVED);
+		Sudoku::SolutionReport report;
+		ASSERT_TRUE(engine.isSolved(solutions[i], puzzles[i], report));
+	}
+	// both threads may miss before either inserts, every later puzzle is a hit
+	ASSERT_GE(stats.cache_hits, count - 2);
+
+	engine.setCacheCapacity(0);
+	ASSERT_EQ(engine.getCacheCapacity(), 0);
+	stats = Sudoku::SolverStats();
+	ASSERT_EQ(engine.solve(puzzles, count, solutions, statuses, &stats), count);
+	ASSERT_EQ(stats.cache_hits, 0);
+}
@@ -3,8 +3,16 @@
 #include "../Sudoku/Checker/SudokuChecker.cpp"
 #include "../Sudoku/Sudoku/Board.hpp"
 #include "../Sudoku/Sudoku/Board.cpp"
+#include "../Sudoku/Sudoku/IndexBoard.hpp"
+#include "../Sudoku/Sudoku/IndexBoard.cpp"
+#include "../Sudoku/Sudoku/BoardBatch.hpp"
+#include "../Sudoku/Sudoku/BoardBatch.cpp"
 #include "../Sudoku/Constants.hpp"
 #include "Constants.hpp"
+#include <random>
+#include <vector>
+#include <memory>
+#include <algorithm>
 
 using Constants::BOARD_SIZE;
 using namespace TestConstants;
@@ -83,4 +91,219 @@ TEST_F(SudokuCheckerTest, IncorrectTempered){
 	EXPECT_EQ(incorrect_values, 9);
 	EXPECT_EQ(empty_cells, 0);
 	ASSERT_FALSE(good);
-}
\ No newline at end of file
+}
+
+TEST_F(SudokuCheckerTest, InvalidCharacter){
+	Sudoku::Board board(valid_matrix);
+	board[0][0] = 'x';
+	EXPECT_FALSE(checker.isValid(board));
+	bool good = checker.isSolved(board, valid_board, correct_values, incorrect_values, empty_cells);
+	ASSERT_FALSE(good);
+}
+
+TEST_F(SudokuCheckerTest, KeyIndex){
+	for(int k=0; k<BOARD_SIZE; k++)
+		EXPECT_EQ(Constants::keyIndex(Constants::ALPHABET[k]), k);
+	EXPECT_EQ(Constants::keyIndex(Constants::EMPTY_CELL), -1);
+	EXPECT_EQ(Constants::keyIndex('0'), -1);
+	EXPECT_EQ(Constants::keyIndex('\xff'), -1);
+	static_assert(Constants::keyIndex('9') == 8, "the table is built at compile time");
+}
+
+TEST_F(SudokuCheckerTest, IndexBoard){
+	Sudoku::IndexBoard index_board(valid_board);
+	Sudoku::Board board;
+	index_board.toBoard(board);
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			EXPECT_EQ(board[i][j], valid_board[i][j]);
+			EXPECT_EQ(index_board[i][j], valid_board[i][j] == Constants::EMPTY_CELL ? Sudoku::IndexBoard::EMPTY : valid_board[i][j] - '1');
+		}
+	}
+	EXPECT_TRUE(checker.isValid(index_board));
+	EXPECT_TRUE(checker.isValid(Sudoku::IndexBoard()));
+	EXPECT_FALSE(checker.isValid(Sudoku::IndexBoard(Sudoku::Board(row_invalid_matrix))));
+	EXPECT_FALSE(checker.isValid(Sudoku::IndexBoard(Sudoku::Board(col_invalid_matrix))));
+	EXPECT_FALSE(checker.isValid(Sudoku::IndexBoard(Sudoku::Board(block_invalid_matrix))));
+
+	board[4][4] = 'x';
+	ASSERT_THROW(Sudoku::IndexBoard bad(board), std::invalid_argument);
+}
+
+TEST_F(SudokuCheckerTest, MatchesIndexBoard){
+	// random boards with a few values each are valid about half of the time, every rule gets broken
+	std::mt19937 random_gen(17);
+	int valid_cnt = 0;
+	for(int n=0; n<2000; n++){
+		Sudoku::Board board;
+		int value_cnt = 1 + random_gen() % 24;
+		for(int v=0; v<value_cnt; v++)
+			board[random_gen() % BOARD_SIZE][random_gen() % BOARD_SIZE] = Constants::ALPHABET[random_gen() % BOARD_SIZE];
+		bool valid = checker.isValid(board);
+		ASSERT_EQ(valid, checker.isValid(Sudoku::IndexBoard(board)));
+		valid_cnt += valid;
+	}
+	EXPECT_GT(valid_cnt, 0);
+	EXPECT_LT(valid_cnt, 2000);
+}
+
+TEST_F(SudokuCheckerTest, Batch){
+	Sudoku::Board bad_character(valid_matrix);
+	bad_character[8][8] = '0';
+	const Sudoku::Board boards[] = {
+		valid_board, Sudoku::Board(row_invalid_matrix), Sudoku::Board(col_invalid_matrix),
+		Sudoku::Board(block_invalid_matrix), Sudoku::Board(solution_matrix), empty_board, bad_character
+	};
+	const bool expected[] = {true, false, false, false, true, true, false};
+	bool results[7];
+	EXPECT_EQ(checker.isValid(boards, 7, results), 3);
+	for(int b=0; b<7; b++)
+		EXPECT_EQ(results[b], expected[b]) << "board " << b << ", " << Sudoku::SudokuChecker::getKernelName() << " kernel";
+}
+
+TEST_F(SudokuCheckerTest, CellReport){
+	Sudoku::Board board(solution_matrix);
+	Sudoku::SolutionReport report;
+	ASSERT_TRUE(checker.isSolved(board, valid_board, report));
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++)
+			EXPECT_EQ(report.status[i][j], valid_board[i][j] == Constants::EMPTY_CELL ? Sudoku::CELL_CORRECT : Sudoku::CELL_GIVEN);
+	}
+
+	// find a given and an empty cell of the start board in the same row
+	int row = 0, given = -1, free = -1;
+	for(; row<BOARD_SIZE && (given < 0 || free < 0); row++){
+		given = free = -1;
+		for(int j=0; j<BOARD_SIZE; j++){
+			if(valid_board[row][j] == Constants::EMPTY_CELL) free = j;
+			else given = j;
+		}
+	}
+	row--;
+	ASSERT_GE(given, 0);
+	ASSERT_GE(free, 0);
+
+	// the given's value written to the empty cell conflicts with the given, and the value it replaced is missing
+	board[row][free] = valid_board[row][given];
+	EXPECT_FALSE(checker.isSolved(board, valid_board, report));
+	EXPECT_EQ(report.status[row][free], Sudoku::CELL_CONFLICTING);
+	EXPECT_EQ(report.status[row][given], Sudoku::CELL_GIVEN);
+	EXPECT_GE(report.incorrect_values, 1); // the value may repeat in the column or block of the cell as well
+
+	board[row][free] = Constants::EMPTY_CELL;
+	board[row][given] = Constants::EMPTY_CELL;
+	EXPECT_FALSE(checker.isSolved(board, valid_board, report));
+	EXPECT_EQ(report.status[row][free], Sudoku::CELL_EMPTY);
+	EXPECT_EQ(report.status[row][given], Sudoku::CELL_TAMPERED);
+	EXPECT_EQ(report.empty_cells, 2);
+	EXPECT_EQ(report.incorrect_values, 0);
+}
+
+TEST_F(SudokuCheckerTest, CellReportCounts){
+	Sudoku::Board board(tempered_correct_matrix);
+	Sudoku::SolutionReport report;
+	EXPECT_FALSE(checker.isSolved(board, valid_board, report));
+	int counts[5] = {};
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++)
+			counts[report.status[i][j]]++;
+	}
+	EXPECT_EQ(counts[Sudoku::CELL_CORRECT], 56);
+	EXPECT_EQ(counts[Sudoku::CELL_CONFLICTING] + counts[Sudoku::CELL_TAMPERED], 9);
+	EXPECT_EQ(report.correct_values, 56);
+	EXPECT_EQ(report.incorrect_values, 9);
+}
+
+TEST_F(SudokuCheckerTest, BoardBatch){
+	Sudoku::BoardBatch batch;
+	Sudoku::Board solution(solution_matrix), board;
+	for(int n=0; n<40; n++)
+		batch.addBoard(n % 2 ? solution : valid_board);
+	EXPECT_EQ(batch.size(), 40);
+	EXPECT_EQ(batch.getStride() % Sudoku::BoardBatch::LANE_COUNT, 0);
+	EXPECT_GE(batch.getStride(), batch.size());
+	for(size_t n=0; n<batch.size(); n++){
+		batch.getBoard(n, board);
+		const Sudoku::Board& expected = n % 2 ? solution : valid_board;
+		for(int k=0; k<Sudoku::BoardBatch::CELL_COUNT; k++){
+			ASSERT_EQ(board[k / BOARD_SIZE][k % BOARD_SIZE], expected[k / BOARD_SIZE][k % BOARD_SIZE]);
+			ASSERT_EQ(batch.getCell(k)[n], expected[k / BOARD_SIZE][k % BOARD_SIZE]);
+		}
+	}
+
+	// shrinking empties the removed boards, growing adds empty boards
+	batch.resize(3);
+	batch.resize(5);
+	batch.getBoard(4, board);
+	for(int k=0; k<Sudoku::BoardBatch::CELL_COUNT; k++)
+		ASSERT_EQ(board[k / BOARD_SIZE][k % BOARD_SIZE], Constants::EMPTY_CELL);
+	EXPECT_THROW(batch.getBoard(5, board), std::out_of_range);
+	EXPECT_THROW(batch.setBoard(5, board), std::out_of_range);
+	batch.clear();
+	EXPECT_EQ(batch.size(), 0);
+}
+
+TEST_F(SudokuCheckerTest, BatchKernel){
+	// sizes around the 32 boards of the kernel, the results must match the single board kernel
+	std::mt19937 random_gen(19);
+	for(size_t count : {1, 31, 32, 33, 100}){
+		Sudoku::BoardBatch batch;
+		std::vector<bool> expected;
+		for(size_t n=0; n<count; n++){
+			Sudoku::Board board = n % 3 ? Sudoku::Board(solution_matrix) : Sudoku::Board();
+			int value_cnt = random_gen() % 6;
+			for(int v=0; v<value_cnt; v++)
+				board[random_gen() % BOARD_SIZE][random_gen() % BOARD_SIZE] = n % 7 == 0 && v == 0 ? 'x' : Constants::ALPHABET[random_gen() % BOARD_SIZE];
+			batch.addBoard(board);
+			expected.push_back(checker.isValid(board));
+		}
+		std::unique_ptr<bool[]> results(new bool[count]);
+		size_t valid_cnt = checker.isValid(batch, results.get());
+		EXPECT_EQ(valid_cnt, size_t(std::count(expected.begin(), expected.end(), true)));
+		for(size_t n=0; n<count; n++)
+			ASSERT_EQ(results[n], expected[n]) << "board " << n << " of " << count << ", " << Sudoku::SudokuChecker::getKernelName() << " kernel";
+	}
+}
+
+TEST_F(SudokuCheckerTest, BoardSizes){
+	// shifted rows form a valid full 16x16 board
+	typedef Sudoku::BoardTraits<4> Traits;
+	Sudoku::BasicBoard<4> solution, start_board;
+	int blank_cnt = 0;
+	for(int i=0; i<Traits::BOARD_SIZE; i++){
+		for(int j=0; j<Traits::BOARD_SIZE; j++){
+			solution[i][j] = Traits::symbol(((i%4)*4 + i/4 + j) % Traits::BOARD_SIZE);
+			start_board[i][j] = (i + j) % 3 == 0 ? solution[i][j] : Constants::EMPTY_CELL;
+			blank_cnt += start_board[i][j] == Constants::EMPTY_CELL;
+		}
+	}
+	ASSERT_TRUE(checker.isValid(solution));
+	ASSERT_TRUE(checker.isValid(start_board));
+	ASSERT_TRUE(checker.isSolved(solution, start_board, correct_values, incorrect_values, empty_cells));
+	ASSERT_EQ(correct_values, blank_cnt);
+	ASSERT_EQ(incorrect_values, 0);
+	ASSERT_EQ(empty_cells, 0);
+
+	// a repeated value, a character of a bigger alphabet and a changed given
+	Sudoku::BasicBoard<4> board(solution);
+	std::swap(board[1][0], board[1][1]);
+	ASSERT_FALSE(checker.isValid(board));
+	ASSERT_FALSE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	board = solution;
+	board[2][0] = 'H';
+	ASSERT_FALSE(checker.isValid(board));
+	ASSERT_FALSE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	board = solution;
+	board[0][0] = Constants::EMPTY_CELL;
+	ASSERT_TRUE(checker.isValid(board));
+	ASSERT_FALSE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	ASSERT_EQ(empty_cells, 1);
+
+	Sudoku::BasicBoard<2> small;
+	small[0][0] = small[3][3] = '4';
+	ASSERT_TRUE(checker.isValid(small));
+	small[0][3] = '4';
+	ASSERT_FALSE(checker.isValid(small));
+	small[0][3] = '5';
+	ASSERT_FALSE(checker.isValid(small));
+}
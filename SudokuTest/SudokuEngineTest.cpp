@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "../Sudoku/Engine/SudokuEngine.hpp"
+#include "../Sudoku/Engine/SudokuEngine.cpp"
+#include "../Sudoku/Batch/BatchGenerator.hpp"
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "../Sudoku/Constants.hpp"
+#include "Constants.hpp"
+#include <vector>
+
+using Constants::BOARD_SIZE;
+
+class SudokuEngineTest : public ::testing::Test {
+protected:
+	Sudoku::SudokuEngine engine;
+
+	static bool sameBoard(const Sudoku::Board& a, const Sudoku::Board& b){
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(a[i][j] != b[i][j])
+					return false;
+			}
+		}
+		return true;
+	}
+};
+
+TEST_F(SudokuEngineTest, Solve) {
+	Sudoku::Board puzzle(TestConstants::valid_matrix);
+	Sudoku::Board solution;
+	ASSERT_EQ(engine.solve(puzzle, solution), Sudoku::SOLVE_SOLVED);
+	Sudoku::SolutionReport report;
+	ASSERT_TRUE(engine.isSolved(solution, puzzle, report));
+
+	Sudoku::Board impossible(TestConstants::impossible_matrix);
+	ASSERT_EQ(engine.solve(impossible, solution), Sudoku::SOLVE_UNSOLVABLE);
+	ASSERT_TRUE(sameBoard(solution, impossible));
+
+	Sudoku::Board invalid(TestConstants::row_invalid_matrix);
+	Sudoku::SolverStats stats;
+	ASSERT_EQ(engine.solve(invalid, solution, stats), Sudoku::SOLVE_INVALID);
+	ASSERT_TRUE(sameBoard(solution, invalid));
+	ASSERT_EQ(stats.solves, 0);
+	ASSERT_EQ(engine.solve(puzzle, solution, stats), Sudoku::SOLVE_SOLVED);
+	ASSERT_EQ(stats.solves, 1);
+}
+
+TEST_F(SudokuEngineTest, SolveArray) {
+	const Sudoku::Board puzzles[] = {
+		Sudoku::Board(TestConstants::valid_matrix),
+		Sudoku::Board(TestConstants::impossible_matrix),
+		Sudoku::Board(TestConstants::row_invalid_matrix),
+		Sudoku::Board(TestConstants::hard_matrix)
+	};
+	std::vector<Sudoku::Board> boards;
+	for(int i=0; i<100; i++)
+		boards.push_back(puzzles[i % 4]);
+
+	Sudoku::SudokuEngine parallel(4);
+	ASSERT_EQ(parallel.getThreadCount(), 4);
+	parallel.setSolverEngine(Sudoku::DANCING_LINKS);
+	std::vector<Sudoku::SolveStatus> statuses(boards.size());
+	Sudoku::SolverStats stats;
+	// the solutions overwrite the puzzles
+	ASSERT_EQ(parallel.solve(boards.data(), boards.size(), boards.data(), statuses.data(), &stats), 50);
+	ASSERT_EQ(stats.solves, 75);
+
+	Sudoku::Board expected;
+	for(size_t i=0; i<boards.size(); i++){
+		Sudoku::SolveStatus status = engine.solve(puzzles[i % 4], expected);
+		ASSERT_EQ(statuses[i], status);
+		ASSERT_TRUE(sameBoard(boards[i], expected));
+	}
+	ASSERT_EQ(parallel.solve(boards.data(), 0, boards.data()), 0);
+}
+
+TEST_F(SudokuEngineTest, CountSolutions) {
+	ASSERT_EQ(engine.countSolutions(Sudoku::Board(TestConstants::hard_matrix)), 1);
+	ASSERT_EQ(engine.countSolutions(Sudoku::Board(TestConstants::impossible_matrix)), 0);
+	ASSERT_EQ(engine.countSolutions(Sudoku::Board(TestConstants::row_invalid_matrix)), 0);
+	ASSERT_EQ(engine.countSolutions(Sudoku::Board(), 5), 5);
+}
+
+TEST_F(SudokuEngineTest, NodeLimit) {
+	Sudoku::Board hard(TestConstants::hard_matrix), solution;
+	engine.setSolverEngine(Sudoku::DANCING_LINKS);
+	ASSERT_EQ(engine.getNodeLimit(), 0);
+	engine.setNodeLimit(1);
+	ASSERT_EQ(engine.getNodeLimit(), 1);
+	ASSERT_EQ(engine.solve(hard, solution), Sudoku::SOLVE_BUDGET);
+	ASSERT_TRUE(sameBoard(solution, hard));
+	ASSERT_EQ(engine.countSolutions(hard), -1);
+
+	// every puzzle gets the whole limit
+	engine.setNodeLimit(10000);
+	for(int i=0; i<20; i++)
+		ASSERT_EQ(engine.solve(hard, solution), Sudoku::SOLVE_SOLVED);
+	ASSERT_EQ(engine.countSolutions(hard), 1);
+
+	Sudoku::SudokuEngine parallel(2);
+	parallel.setSolverEngine(Sudoku::DANCING_LINKS);
+	parallel.setNodeLimit(1);
+	std::vector<Sudoku::Board> boards(8, hard);
+	std::vector<Sudoku::SolveStatus> statuses(boards.size());
+	ASSERT_EQ(parallel.solve(boards.data(), boards.size(), boards.data(), statuses.data()), 0);
+	for(Sudoku::SolveStatus status : statuses)
+		ASSERT_EQ(status, Sudoku::SOLVE_BUDGET);
+	parallel.setNodeLimit(0);
+	ASSERT_EQ(parallel.solve(boards.data(), boards.size(), boards.data(), statuses.data()), boards.size());
+}
+
+TEST_F(SudokuEngineTest, Generate) {
+	engine.setUnique(true);
+	engine.setDifficulty(Sudoku::HARD);
+	Sudoku::Board first, second;
+	engine.generate(first, 42);
+	engine.generate(second, 42);
+	ASSERT_TRUE(sameBoard(first, second));
+	ASSERT_TRUE(engine.isValid(first));
+	ASSERT_EQ(engine.countSolutions(first), 1);
+
+	// the n-th board of an array does not depend on the thread count and matches a pack of BatchGenerator
+	const int count = 12;
+	Sudoku::SudokuEngine parallel(3);
+	parallel.setUnique(true);
+	parallel.setDifficulty(Sudoku::HARD);
+	std::vector<Sudoku::Board> boards(count);
+	parallel.generate(boards.data(), count, 7);
+	Sudoku::BatchGenerator batch_generator(Sudoku::HARD, true, 1, 7);
+	int b = 0;
+	batch_generator.generate(count, [&](const Sudoku::Board& board){
+		ASSERT_TRUE(sameBoard(board, boards[b]));
+		engine.generate(first, Sudoku::SudokuGenerator::deriveSeed(7, b));
+		ASSERT_TRUE(sameBoard(first, boards[b]));
+		b++;
+	});
+	ASSERT_EQ(b, count);
+}
+
+TEST_F(SudokuEngineTest, CheckAndGrade) {
+	const Sudoku::Board boards[] = {
+		Sudoku::Board(TestConstants::valid_matrix),
+		Sudoku::Board(TestConstants::row_invalid_matrix)
+	};
+	bool results[2];
+	ASSERT_EQ(engine.isValid(boards, 2, results), 1);
+	ASSERT_TRUE(results[0]);
+	ASSERT_FALSE(results[1]);
+
+	Sudoku::GradeReport report = engine.grade(Sudoku::Board(TestConstants::hard_matrix));
+	ASSERT_TRUE(report.solved);
+}
@@ -1,11 +1,17 @@
 #include "pch.h"
 #include "../Sudoku/Generator/SudokuGenerator.hpp"
 #include "../Sudoku/Generator/SudokuGenerator.cpp"
+#include "../Sudoku/Batch/BatchGenerator.hpp"
+#include "../Sudoku/Batch/BatchGenerator.cpp"
 #include "../Sudoku/Solver/SudokuSolver.hpp"
+#include "../Sudoku/Solver/SearchBudget.hpp"
+#include "../Sudoku/Solver/DancingLinks.hpp"
 #include "../Sudoku/Checker/SudokuChecker.hpp"
 #include "../Sudoku/Sudoku/Board.hpp"
 #include "../Sudoku/Sudoku/MarkedBoard.hpp"
 #include "../Sudoku/Constants.hpp"
+#include <sstream>
+#include <vector>
 
 using Constants::BOARD_SIZE;
 
@@ -72,4 +78,224 @@ TEST_F(SudokuGeneratorTest, Unique){
 	generator.setUnique(true);
 	generator.generateBoard(board);
 	checkBoard(board);
-}
\ No newline at end of file
+}
+
+TEST_F(SudokuGeneratorTest, UniqueDancingLinks){
+	generator.setUnique(true);
+	generator.setSolverEngine(Sudoku::DANCING_LINKS);
+	generator.generateBoard(board);
+	checkBoard(board);
+	Sudoku::DancingLinks dancing_links;
+	ASSERT_EQ(dancing_links.countSolutions(board, 2), 1);
+}
+
+TEST_F(SudokuGeneratorTest, UniqueSolutionCount){
+	// both checks keep exactly the removals that leave one solution, so they generate the same boards
+	Sudoku::SudokuGenerator searching(Sudoku::HARD, true), counting(Sudoku::HARD, true);
+	counting.setUniquenessCheck(Sudoku::SOLUTION_COUNT);
+	counting.setThreadCount(4);
+	searching.setSeed(13);
+	counting.setSeed(13);
+	Sudoku::DancingLinks dancing_links;
+	for(int _=0; _<3; _++){
+		Sudoku::Board board1, board2;
+		searching.generateBoard(board1);
+		counting.generateBoard(board2);
+		ASSERT_EQ(dancing_links.countSolutions(board2, 2), 1);
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ(board1[i][j], board2[i][j]);
+			}
+		}
+	}
+
+	// the counts are charged to the budget like the searches
+	Sudoku::SearchBudget unlimited;
+	Sudoku::GenerationStats stats;
+	Sudoku::Board budgeted;
+	ASSERT_TRUE(counting.generateBoard(budgeted, unlimited, stats));
+	ASSERT_GT(stats.check_nodes, 0u);
+	ASSERT_EQ(stats.fill_nodes + stats.check_nodes, unlimited.getNodes());
+}
+
+TEST_F(SudokuGeneratorTest, Seeded) {
+	Sudoku::SudokuGenerator other(Sudoku::MEDIUM, true);
+	generator.setUnique(true);
+	generator.setSeed(7);
+	other.setSeed(7);
+	for(int _=0; _<3; _++){
+		Sudoku::Board board1, board2;
+		generator.generateBoard(board1);
+		other.generateBoard(board2);
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				ASSERT_EQ(board1[i][j], board2[i][j]);
+			}
+		}
+	}
+	ASSERT_NE(Sudoku::SudokuGenerator::deriveSeed(7, 0), Sudoku::SudokuGenerator::deriveSeed(7, 1));
+
+	// the draws do not depend on the standard library, so a seed gives this board everywhere
+	const char* expected = "4.97..5..752.48.1.3..9.5..45.4..6.9..73489...6.8.5..7.94516.83.8.6.3.9.223.......";
+	Sudoku::SudokuGenerator pinned(Sudoku::MEDIUM, true);
+	pinned.setSeed(7);
+	Sudoku::Board board;
+	pinned.generateBoard(board);
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			char value = expected[i*BOARD_SIZE + j];
+			ASSERT_EQ(board[i][j], value == '.' ? Constants::EMPTY_CELL : value);
+		}
+	}
+}
+
+TEST_F(SudokuGeneratorTest, BatchGenerate) {
+	std::stringstream single, parallel;
+	Sudoku::BatchGenerator(Sudoku::HARD, true, 1, 42).generate(40, single, FileIO::LINE);
+	Sudoku::BatchGenerator(Sudoku::HARD, true, 3, 42).generate(40, parallel, FileIO::LINE);
+	ASSERT_EQ(single.str(), parallel.str());
+
+	std::vector<Sudoku::Board> boards;
+	Sudoku::BatchGenerator(Sudoku::HARD, true, 2, 42).generate(40, [&](const Sudoku::Board& board){
+		boards.push_back(board);
+	});
+	ASSERT_EQ(boards.size(), 40);
+	for(Sudoku::Board& b : boards)
+		checkBoard(b);
+}
+
+TEST_F(SudokuGeneratorTest, ParallelUniquenessChecks) {
+	for(Sudoku::SolverEngine engine : {Sudoku::BACKTRACKING, Sudoku::BITBOARD, Sudoku::DANCING_LINKS}){
+		Sudoku::SudokuGenerator serial(Sudoku::HARD, true), parallel(Sudoku::HARD, true);
+		serial.setSolverEngine(engine);
+		parallel.setThreadCount(4);
+		parallel.setSolverEngine(engine);
+		serial.setSeed(11);
+		parallel.setSeed(11);
+		for(int _=0; _<3; _++){
+			Sudoku::Board board1, board2;
+			serial.generateBoard(board1);
+			parallel.generateBoard(board2);
+			for(int i=0; i<BOARD_SIZE; i++){
+				for(int j=0; j<BOARD_SIZE; j++){
+					ASSERT_EQ(board1[i][j], board2[i][j]);
+				}
+			}
+		}
+	}
+}
+
+TEST_F(SudokuGeneratorTest, Budgeted) {
+	Sudoku::SudokuGenerator unbounded(Sudoku::HARD, true), budgeted(Sudoku::HARD, true);
+	unbounded.setSeed(5);
+	budgeted.setSeed(5);
+	Sudoku::Board board1, board2;
+	unbounded.generateBoard(board1);
+	Sudoku::SearchBudget unlimited;
+	Sudoku::GenerationStats stats;
+	ASSERT_TRUE(budgeted.generateBoard(board2, unlimited, stats));
+	ASSERT_TRUE(stats.complete);
+	ASSERT_EQ(stats.attempts, 1);
+	ASSERT_GT(stats.fill_nodes, 0u);
+	ASSERT_GT(stats.check_nodes, 0u);
+	ASSERT_GT(stats.uniqueness_checks, 0);
+	ASSERT_EQ(stats.fill_nodes + stats.check_nodes, unlimited.getNodes());
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board1[i][j], board2[i][j]);
+		}
+	}
+
+	// the budget runs out during the uniqueness checks, the verified removals are kept
+	Sudoku::SearchBudget nodes;
+	nodes.setNodeLimit(stats.fill_nodes + stats.check_nodes / 2);
+	Sudoku::Board partial;
+	budgeted.setSeed(5);
+	ASSERT_FALSE(budgeted.generateBoard(partial, nodes, stats));
+	ASSERT_FALSE(stats.complete);
+	ASSERT_GT(stats.uniqueness_checks, 0);
+	checkBoard(partial);
+	Sudoku::DancingLinks dancing_links;
+	ASSERT_EQ(dancing_links.countSolutions(partial, 2), 1);
+
+	// an easy board cut short by the budget does not get harder than an easy one
+	Sudoku::SudokuGenerator easy(Sudoku::EASY, true);
+	easy.setSeed(5);
+	Sudoku::SearchBudget easy_nodes;
+	easy_nodes.setNodeLimit(stats.fill_nodes + stats.check_nodes * 9 / 10);
+	Sudoku::Board easy_partial;
+	ASSERT_FALSE(easy.generateBoard(easy_partial, easy_nodes, stats));
+	checkBoard(easy_partial);
+	ASSERT_EQ(dancing_links.countSolutions(easy_partial, 2), 1);
+	ASSERT_GT(countEmpty(easy_partial), 0);
+	ASSERT_LE(countEmpty(easy_partial), 30);
+
+	Sudoku::SearchBudget expired;
+	expired.setDeadline(Sudoku::SearchBudget::Clock::now());
+	Sudoku::Board empty;
+	ASSERT_FALSE(budgeted.generateBoard(empty, expired, stats));
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(empty[i][j], Constants::EMPTY_CELL);
+		}
+	}
+}
+
+// counts the solutions of a board of any size, up to the limit
+template<int BlockSize>
+int countSolutions(Sudoku::BasicMarkedBoard<BlockSize>& board, int limit){
+	int ri, ci;
+	if(!board.findMostConstrainedCell(ri, ci))
+		return 1;
+	int count = 0;
+	for(int k=0; k<Sudoku::BoardTraits<BlockSize>::BOARD_SIZE && count < limit; k++){
+		if(!board.isCandidate(ri, ci, k))
+			continue;
+		board.placeValue(ri, ci, k);
+		count += countSolutions(board, limit - count);
+		board.removeValue(ri, ci, k);
+	}
+	return count;
+}
+
+template<int BlockSize>
+void checkGeneratedSize(Sudoku::Difficulty difficulty, bool unique, int& empty_cnt){
+	Sudoku::SudokuGenerator generator(difficulty, unique), other(difficulty, unique);
+	generator.setSeed(3);
+	other.setSeed(3);
+	Sudoku::BasicBoard<BlockSize> board, same, solution;
+	generator.generateBoard(board);
+	other.generateBoard(same);
+	const int size = Sudoku::BoardTraits<BlockSize>::BOARD_SIZE;
+	for(int i=0; i<size; i++){
+		for(int j=0; j<size; j++){
+			ASSERT_EQ(board[i][j], same[i][j]);
+		}
+	}
+
+	Sudoku::SudokuChecker checker;
+	int correct_values, incorrect_values;
+	ASSERT_TRUE(checker.isValid(board));
+	ASSERT_TRUE(Sudoku::BasicBitboardSolver<BlockSize>().solve(board, solution));
+	ASSERT_TRUE(checker.isSolved(solution, board, correct_values, incorrect_values, empty_cnt));
+	// every value the solver wrote fills a cell the generator cleared
+	empty_cnt = correct_values;
+	ASSERT_GT(empty_cnt, 0);
+	if(unique){
+		Sudoku::BasicMarkedBoard<BlockSize> marked_board(board);
+		ASSERT_EQ(countSolutions(marked_board, 2), 1);
+	}
+}
+
+TEST_F(SudokuGeneratorTest, BoardSizes) {
+	int empty_cnt = 0;
+	checkGeneratedSize<2>(Sudoku::HARD, true, empty_cnt);
+	checkGeneratedSize<4>(Sudoku::EASY, true, empty_cnt);
+	checkGeneratedSize<4>(Sudoku::HARD, true, empty_cnt);
+	// the 31 to 50 cells of a medium 9x9 board, scaled to 256 cells
+	checkGeneratedSize<4>(Sudoku::MEDIUM, false, empty_cnt);
+	ASSERT_GE(empty_cnt, 95);
+	ASSERT_LE(empty_cnt, 158);
+	checkGeneratedSize<5>(Sudoku::EASY, false, empty_cnt);
+	checkGeneratedSize<5>(Sudoku::EASY, true, empty_cnt);
+}
@@ -1,11 +1,19 @@
 #include "pch.h"
 #include "../Sudoku/Solver/SudokuSolver.hpp"
 #include "../Sudoku/Solver/SudokuSolver.cpp"
+#include "../Sudoku/Solver/BitboardSolver.cpp"
+#include "../Sudoku/Solver/ConstraintPropagator.cpp"
+#include "../Sudoku/Solver/DancingLinks.cpp"
+#include "../Sudoku/Solver/SearchBudget.cpp"
+#include "../Sudoku/Solver/SolverStats.cpp"
 #include "../Sudoku/Checker/SudokuChecker.hpp"
 #include "../Sudoku/Sudoku/Board.hpp"
 #include "../Sudoku/Sudoku/MarkedBoard.hpp"
 #include "../Sudoku/Sudoku/MarkedBoard.cpp"
 #include "Constants.hpp"
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
 
 class SudokuSolverTest : public ::testing::Test {
 protected:
@@ -21,6 +29,61 @@ TEST_F(SudokuSolverTest, ValidSolve) {
 	ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
 }
 
+TEST_F(SudokuSolverTest, HardSolve) {
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	Sudoku::MarkedBoard board;
+	ASSERT_TRUE(solver.solve(start_board, board));
+	ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+}
+
+TEST_F(SudokuSolverTest, PropagationCounters) {
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	Sudoku::MarkedBoard board;
+	Sudoku::PropagationCounters counters;
+	ASSERT_TRUE(solver.solve(start_board, board, counters));
+	ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	// the puzzle is solvable by singles alone, so every empty cell is resolved by propagation
+	EXPECT_EQ(counters.naked_singles + counters.hidden_singles, 64);
+	EXPECT_GT(counters.hidden_singles, 0);
+}
+
+TEST_F(SudokuSolverTest, Stats) {
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	Sudoku::Board empty_board;
+	Sudoku::MarkedBoard board;
+	const Sudoku::SolverEngine engines[] = {Sudoku::BACKTRACKING, Sudoku::BITBOARD, Sudoku::DANCING_LINKS};
+	for(Sudoku::SolverEngine engine : engines){
+		solver.setEngine(engine);
+		Sudoku::SolverStats stats, total;
+		ASSERT_TRUE(solver.solve(start_board, board, stats));
+		EXPECT_EQ(stats.solves, 1);
+		EXPECT_GT(stats.nodes, 0);
+		EXPECT_GT(stats.time.count(), 0);
+		EXPECT_EQ(stats.time, stats.max_time);
+		if(engine == Sudoku::BACKTRACKING){
+			// singles solve the puzzle without a guess
+			EXPECT_EQ(stats.getPropagations(), 64);
+			EXPECT_EQ(stats.max_depth, 0);
+		} else {
+			EXPECT_EQ(stats.getPropagations(), 0);
+			EXPECT_GT(stats.max_depth, 0);
+		}
+
+		// an empty board needs guesses, the impossible one fails after backtracking
+		total += stats;
+		ASSERT_TRUE(solver.solve(empty_board, board, total));
+		Sudoku::SolverStats impossible;
+		ASSERT_FALSE(solver.solve(Sudoku::Board(TestConstants::impossible_matrix), board, impossible));
+		total += impossible;
+		EXPECT_EQ(total.solves, 3);
+		EXPECT_GT(total.nodes, stats.nodes);
+		EXPECT_GT(total.max_depth, 0);
+		EXPECT_GE(total.time, total.max_time);
+		EXPECT_GE(total.max_time, stats.max_time);
+		EXPECT_GE(total.backtracks, impossible.backtracks);
+	}
+}
+
 TEST_F(SudokuSolverTest, Impossible) {
 	Sudoku::Board start_board(TestConstants::impossible_matrix);
 	Sudoku::MarkedBoard board;
@@ -30,4 +93,232 @@ TEST_F(SudokuSolverTest, Impossible) {
 			ASSERT_EQ(board[i][j], start_board[i][j]);
 		}
 	}
-}
\ No newline at end of file
+}
+
+TEST_F(SudokuSolverTest, BitboardValidSolve) {
+	solver.setEngine(Sudoku::BITBOARD);
+	Sudoku::Board start_board(TestConstants::valid_matrix);
+	Sudoku::MarkedBoard board;
+	ASSERT_TRUE(solver.solve(start_board, board));
+	ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+}
+
+TEST_F(SudokuSolverTest, BitboardHardSolve) {
+	solver.setEngine(Sudoku::BITBOARD);
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	Sudoku::MarkedBoard board;
+	ASSERT_TRUE(solver.solve(start_board, board));
+	ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+}
+
+TEST_F(SudokuSolverTest, BitboardImpossible) {
+	solver.setEngine(Sudoku::BITBOARD);
+	Sudoku::Board start_board(TestConstants::impossible_matrix);
+	Sudoku::MarkedBoard board;
+	ASSERT_FALSE(solver.solve(start_board, board));
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board[i][j], start_board[i][j]);
+		}
+	}
+}
+
+TEST_F(SudokuSolverTest, DancingLinksSolve) {
+	solver.setEngine(Sudoku::DANCING_LINKS);
+	// the same node pool is reused for every puzzle
+	for(auto matrix : {TestConstants::valid_matrix, TestConstants::hard_matrix, TestConstants::valid_matrix}){
+		Sudoku::Board start_board(matrix);
+		Sudoku::MarkedBoard board;
+		ASSERT_TRUE(solver.solve(start_board, board));
+		ASSERT_TRUE(checker.isSolved(board, start_board, correct_values, incorrect_values, empty_cells));
+	}
+}
+
+TEST_F(SudokuSolverTest, DancingLinksImpossible) {
+	solver.setEngine(Sudoku::DANCING_LINKS);
+	Sudoku::Board start_board(TestConstants::impossible_matrix);
+	Sudoku::MarkedBoard board;
+	ASSERT_FALSE(solver.solve(start_board, board));
+	for(int i=0; i<BOARD_SIZE; i++){
+		for(int j=0; j<BOARD_SIZE; j++){
+			ASSERT_EQ(board[i][j], start_board[i][j]);
+		}
+	}
+}
+
+TEST_F(SudokuSolverTest, InvalidCharacter) {
+	Sudoku::Board start_board(TestConstants::valid_matrix);
+	start_board[0][0] = 'x';
+	// every engine rejects the board like the MarkedBoard it is solved into, none reads the character as a value
+	for(Sudoku::SolverEngine engine : {Sudoku::BACKTRACKING, Sudoku::BITBOARD, Sudoku::DANCING_LINKS}){
+		Sudoku::SudokuSolver checked(engine);
+		Sudoku::MarkedBoard board;
+		ASSERT_THROW(checked.solve(start_board, board), std::invalid_argument) << engine;
+	}
+	Sudoku::Board bitboard_solution;
+	ASSERT_FALSE(Sudoku::BitboardSolver().solve(start_board, bitboard_solution));
+	ASSERT_EQ(Sudoku::DancingLinks().countSolutions(start_board, 2), 0);
+
+	// a letter beyond the alphabet of the size is not a value either
+	Sudoku::BasicBoard<4> big, solution;
+	big[0][0] = 'H';
+	ASSERT_FALSE(Sudoku::BasicBitboardSolver<4>().solve(big, solution));
+	big[0][0] = 'G';
+	ASSERT_TRUE(Sudoku::BasicBitboardSolver<4>().solve(big, solution));
+}
+
+TEST_F(SudokuSolverTest, DancingLinksCount) {
+	Sudoku::DancingLinks dancing_links;
+	EXPECT_EQ(dancing_links.countSolutions(Sudoku::Board(TestConstants::hard_matrix), 2), 1);
+	EXPECT_EQ(dancing_links.countSolutions(Sudoku::Board(TestConstants::solution_matrix), 2), 1);
+	EXPECT_EQ(dancing_links.countSolutions(Sudoku::Board(), 2), 2);
+	EXPECT_EQ(dancing_links.countSolutions(Sudoku::Board(TestConstants::row_invalid_matrix), 2), 0);
+	EXPECT_EQ(dancing_links.countSolutions(Sudoku::Board(TestConstants::impossible_matrix), 2), 0);
+}
+TEST_F(SudokuSolverTest, Cancelled) {
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	std::atomic<bool> cancel(true);
+	for(Sudoku::SolverEngine engine : {Sudoku::BACKTRACKING, Sudoku::BITBOARD, Sudoku::DANCING_LINKS}){
+		Sudoku::SudokuSolver cancelled(engine);
+		cancelled.setCancelFlag(&cancel);
+		Sudoku::MarkedBoard board;
+		ASSERT_FALSE(cancelled.solve(start_board, board));
+		cancelled.setCancelFlag(nullptr);
+		ASSERT_TRUE(cancelled.solve(start_board, board));
+	}
+}
+
+TEST_F(SudokuSolverTest, Budget) {
+	Sudoku::Board start_board(TestConstants::hard_matrix);
+	for(Sudoku::SolverEngine engine : {Sudoku::BACKTRACKING, Sudoku::BITBOARD, Sudoku::DANCING_LINKS}){
+		Sudoku::SudokuSolver budgeted(engine);
+		Sudoku::MarkedBoard board;
+		Sudoku::SearchBudget nodes;
+		nodes.setNodeLimit(1);
+		budgeted.setSearchBudget(&nodes);
+		// propagation alone cannot fill the empty board, so the search needs more than one node
+		ASSERT_FALSE(budgeted.solve(Sudoku::Board(), board));
+		ASSERT_TRUE(nodes.exhausted());
+		ASSERT_GT(nodes.getNodes(), 1u);
+
+		Sudoku::SearchBudget expired;
+		expired.setDeadline(Sudoku::SearchBudget::Clock::now());
+		budgeted.setSearchBudget(&expired);
+		ASSERT_FALSE(budgeted.solve(start_board, board));
+
+		Sudoku::SearchBudget unlimited;
+		budgeted.setSearchBudget(&unlimited);
+		ASSERT_TRUE(budgeted.solve(start_board, board));
+		ASSERT_FALSE(unlimited.exhausted());
+		ASSERT_GT(unlimited.getNodes(), 0u);
+	}
+}
+
+// every row, column and block of a full board holds every value of the alphabet exactly once
+template<int BlockSize>
+bool isSolution(const Sudoku::BasicBoard<BlockSize>& board){
+	typedef Sudoku::BoardTraits<BlockSize> Traits;
+	const int size = Traits::BOARD_SIZE;
+	for(int u=0; u<size; u++){
+		uint64_t row = 0, col = 0, block = 0;
+		for(int t=0; t<size; t++){
+			int r = (u/BlockSize)*BlockSize + t/BlockSize, c = (u%BlockSize)*BlockSize + t%BlockSize;
+			int values[3] = {Traits::index(board[u][t]), Traits::index(board[t][u]), Traits::index(board[r][c])};
+			for(int v : values){
+				if(v < 0)
+					return false;
+			}
+			row |= 1ull << values[0];
+			col |= 1ull << values[1];
+			block |= 1ull << values[2];
+		}
+		uint64_t full = (1ull << size) - 1;
+		if(row != full || col != full || block != full)
+			return false;
+	}
+	return true;
+}
+
+template<int BlockSize>
+void checkBitboardSize(int clear_every){
+	typedef Sudoku::BoardTraits<BlockSize> Traits;
+	const int size = Traits::BOARD_SIZE;
+	// shifted rows form a valid full board, every clear_every-th cell is cleared again
+	Sudoku::BasicBoard<BlockSize> start_board, solution_board;
+	for(int i=0; i<size; i++){
+		for(int j=0; j<size; j++){
+			int k = ((i%BlockSize)*BlockSize + i/BlockSize + j) % size;
+			start_board[i][j] = (i*size + j) % clear_every == 0 ? Constants::EMPTY_CELL : Traits::symbol(k);
+		}
+	}
+	Sudoku::BasicBitboardSolver<BlockSize> bitboard_solver;
+	ASSERT_TRUE(bitboard_solver.solve(start_board, solution_board));
+	ASSERT_TRUE(isSolution(solution_board));
+	for(int i=0; i<size; i++){
+		for(int j=0; j<size; j++){
+			if(start_board[i][j] != Constants::EMPTY_CELL){
+				ASSERT_EQ(start_board[i][j], solution_board[i][j]);
+			}
+		}
+	}
+
+	std::stringstream stream;
+	stream << solution_board;
+	Sudoku::BasicBoard<BlockSize> read_board;
+	stream >> read_board;
+	for(int i=0; i<size; i++){
+		for(int j=0; j<size; j++){
+			ASSERT_EQ(read_board[i][j], solution_board[i][j]);
+		}
+	}
+}
+
+TEST_F(SudokuSolverTest, BitboardSizes) {
+	checkBitboardSize<2>(1);
+	checkBitboardSize<3>(2);
+	checkBitboardSize<4>(2);
+	checkBitboardSize<5>(3);
+
+	// an empty 16x16 board is filled as well
+	Sudoku::BasicBoard<4> empty, solution;
+	Sudoku::BasicBitboardSolver<4> bitboard_solver;
+	ASSERT_TRUE(bitboard_solver.solve(empty, solution));
+	ASSERT_TRUE(isSolution(solution));
+}
+
+TEST_F(SudokuSolverTest, MarkedBoardSizes) {
+	typedef Sudoku::BoardTraits<4> Traits;
+	const int size = Traits::BOARD_SIZE;
+	Sudoku::BasicMarkedBoard<4> board;
+	ASSERT_EQ(board.getCandidateCount(0, 1), size);
+
+	// 'G' is the last value of 16x16 boards, its peers lose it
+	int k = Traits::index('G');
+	board.placeValue(0, 0, k);
+	ASSERT_EQ(board[0][0], 'G');
+	ASSERT_FALSE(board.isCandidate(0, 15, k));
+	ASSERT_FALSE(board.isCandidate(15, 0, k));
+	ASSERT_FALSE(board.isCandidate(3, 3, k));
+	ASSERT_TRUE(board.isCandidate(4, 4, k));
+	ASSERT_EQ(board.getCandidateCount(0, 1), size - 1);
+	ASSERT_EQ(board.getCandidateCount(4, 4), size);
+	board.removeValue(0, 0, k);
+	ASSERT_EQ(board.getCandidateCount(0, 1), size);
+
+	// a row with a single gap makes its cell the most constrained one
+	for(int j=1; j<size; j++)
+		board.placeValue(5, j, j);
+	int ri, ci;
+	ASSERT_TRUE(board.findMostConstrainedCell(ri, ci));
+	ASSERT_EQ(ri, 5);
+	ASSERT_EQ(ci, 0);
+	ASSERT_EQ(board.getCandidateCount(5, 0), 1);
+	ASSERT_TRUE(board.getCandidates(5, 0).test(0));
+
+	Sudoku::BasicBoard<4> plain(board);
+	Sudoku::BasicMarkedBoard<4> copy(plain);
+	ASSERT_EQ(copy.getCandidateCount(5, 0), 1);
+	plain[0][0] = 'H';
+	ASSERT_THROW(Sudoku::BasicMarkedBoard<4> invalid(plain), std::invalid_argument);
+	ASSERT_NO_THROW(Sudoku::BasicMarkedBoard<5> valid{Sudoku::BasicBoard<5>()});
+}
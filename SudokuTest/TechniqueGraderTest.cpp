@@ -0,0 +1,123 @@
+#include "pch.h"
+#include "../Sudoku/Grader/TechniqueGrader.hpp"
+#include "../Sudoku/Grader/TechniqueGrader.cpp"
+#include "../Sudoku/Generator/SudokuGenerator.hpp"
+#include "../Sudoku/Solver/SudokuSolver.hpp"
+#include "../Sudoku/FileIO/FileIO.hpp"
+#include "../Sudoku/Sudoku/Board.hpp"
+#include "../Sudoku/Sudoku/MarkedBoard.hpp"
+#include "Constants.hpp"
+#include <string>
+
+using Constants::BOARD_SIZE;
+
+class TechniqueGraderTest : public ::testing::Test {
+protected:
+	Sudoku::TechniqueGrader grader;
+	Sudoku::SudokuSolver solver;
+
+	Sudoku::Board parse(const std::string& line){
+		Sudoku::Board board;
+		FileIO::parseLine(line, board);
+		return board;
+	}
+
+	// whatever the grader fills must agree with the solution found by search
+	void checkConsistent(const Sudoku::Board& board){
+		Sudoku::Board result;
+		Sudoku::GradeReport report = grader.grade(board, result);
+		Sudoku::MarkedBoard solution;
+		ASSERT_TRUE(solver.solve(board, solution));
+		int empty_cnt = 0;
+		for(int i=0; i<BOARD_SIZE; i++){
+			for(int j=0; j<BOARD_SIZE; j++){
+				if(result[i][j] == Constants::EMPTY_CELL){
+					empty_cnt++;
+				} else {
+					ASSERT_EQ(result[i][j], solution[i][j]);
+				}
+			}
+		}
+		ASSERT_EQ(report.solved, empty_cnt == 0);
+	}
+};
+
+TEST_F(TechniqueGraderTest, Simple){
+	Sudoku::Board board = parse("1...8..2..69.72....5.4..8.7...9.84..2..54..8......319..1..5..4.7..2....9....9..71");
+	Sudoku::GradeReport report = grader.grade(board);
+	ASSERT_TRUE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::SIMPLE);
+	ASSERT_GT(report.technique_counts[Sudoku::NAKED_SINGLE] + report.technique_counts[Sudoku::HIDDEN_SINGLE], 0);
+	checkConsistent(board);
+}
+
+TEST_F(TechniqueGraderTest, Moderate){
+	Sudoku::Board board = parse("4..132........7.54.....9....4..2...31.6....4.....8...7....1...553.2..4..7.954.3.2");
+	Sudoku::GradeReport report = grader.grade(board);
+	ASSERT_TRUE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::MODERATE);
+	ASSERT_GT(report.technique_counts[Sudoku::POINTING] + report.technique_counts[Sudoku::BOX_LINE], 0);
+	checkConsistent(board);
+}
+
+TEST_F(TechniqueGraderTest, Advanced){
+	Sudoku::Board board = parse("4...2...17...1.26...16....46.......91.2..67...8.9.7.26..5.....3.3.8..51.8.7......");
+	Sudoku::GradeReport report = grader.grade(board);
+	ASSERT_TRUE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::ADVANCED);
+	ASSERT_GT(report.technique_counts[Sudoku::NAKED_PAIR] + report.technique_counts[Sudoku::HIDDEN_PAIR], 0);
+	checkConsistent(board);
+}
+
+TEST_F(TechniqueGraderTest, Expert){
+	Sudoku::Board board = parse("231.....48..2..91......7.82346..91...8...4.......7........9..3.1.96..5.8...58.4..");
+	Sudoku::GradeReport report = grader.grade(board);
+	ASSERT_TRUE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::EXPERT);
+	ASSERT_GT(report.technique_counts[Sudoku::X_WING], 0);
+	checkConsistent(board);
+}
+
+TEST_F(TechniqueGraderTest, Solved){
+	Sudoku::Board board(TestConstants::solution_matrix);
+	Sudoku::GradeReport report = grader.grade(board);
+	ASSERT_TRUE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::SIMPLE);
+	ASSERT_EQ(report.score, 0);
+}
+
+TEST_F(TechniqueGraderTest, BeyondTechniques){
+	// an empty board has every solution, no technique can start it
+	Sudoku::GradeReport report = grader.grade(Sudoku::Board());
+	ASSERT_FALSE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::BEYOND_TECHNIQUES);
+	report = grader.grade(Sudoku::Board(TestConstants::impossible_matrix));
+	ASSERT_FALSE(report.solved);
+	ASSERT_EQ(report.grade, Sudoku::BEYOND_TECHNIQUES);
+}
+
+TEST_F(TechniqueGraderTest, Consistent){
+	Sudoku::SudokuGenerator generator(Sudoku::HARD, true);
+	generator.setSeed(13);
+	for(int n=0; n<50; n++){
+		Sudoku::Board board;
+		generator.generateBoard(board);
+		checkConsistent(board);
+	}
+}
+
+TEST_F(TechniqueGraderTest, TargetGrade){
+	Sudoku::SudokuGenerator generator(Sudoku::EASY, true);
+	generator.setSeed(7);
+	const Sudoku::Grade grades[] = {Sudoku::SIMPLE, Sudoku::MODERATE};
+	for(Sudoku::Grade grade : grades){
+		generator.setTargetGrade(grade);
+		for(int n=0; n<5; n++){
+			Sudoku::Board board;
+			generator.generateBoard(board);
+			ASSERT_EQ(grader.grade(board).grade, grade);
+			checkConsistent(board);
+		}
+	}
+	ASSERT_THROW(generator.setTargetGrade(Sudoku::SIMPLE, 0), std::invalid_argument);
+}
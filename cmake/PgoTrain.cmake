@@ -0,0 +1,46 @@
+# Training run of the profile guided optimization build, invoked by the sudoku_pgo_train target:
+#   cmake -DSUDOKU=<game> -DCORPUS=<puzzles> -DPGO_DIR=<profiles> -DWORK_DIR=<scratch> [-DMERGE_TOOL=<llvm-profdata>] -P PgoTrain.cmake
+# Solves the corpus with every engine, generates and grades packs and converts between the file formats, so the
+# profile covers the hot paths of the batch, generate and convert modes. Without MERGE_TOOL (GCC) the profiles are
+# written straight into PGO_DIR, with it (Clang) the raw profiles are merged into PGO_DIR/sudoku.profdata.
+
+foreach(var SUDOKU CORPUS PGO_DIR WORK_DIR)
+	if(NOT DEFINED ${var})
+		message(FATAL_ERROR "PgoTrain.cmake needs -D${var}=...")
+	endif()
+endforeach()
+
+# profiles of an older instrumented build do not match the current sources
+file(REMOVE_RECURSE "${PGO_DIR}" "${WORK_DIR}")
+file(MAKE_DIRECTORY "${PGO_DIR}" "${WORK_DIR}")
+
+function(train)
+	execute_process(COMMAND "${SUDOKU}" ${ARGN} WORKING_DIRECTORY "${WORK_DIR}" RESULT_VARIABLE result OUTPUT_QUIET ERROR_QUIET)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "Training run '${ARGN}' failed: ${result}")
+	endif()
+endfunction()
+
+foreach(engine b m x)
+	train(--batch -s ${engine} -j 1 "${CORPUS}" "solutions_${engine}.txt")
+endforeach()
+train(--batch -j 2 --unordered "${CORPUS}" solutions_parallel.txt)
+foreach(difficulty e m h)
+	train(--generate 64 -d ${difficulty} -j 1 --seed 1 -f l "pack_${difficulty}.txt")
+	train(--generate 32 -u -d ${difficulty} -j 1 --seed 2 -f l "unique_${difficulty}.txt")
+endforeach()
+train(--generate 16 -u -g e -j 1 --seed 3 -f l graded.txt)
+train(--convert "${CORPUS}" corpus.bin)
+train(--convert -f l corpus.bin corpus.txt)
+
+if(MERGE_TOOL)
+	file(GLOB raw_profiles "${PGO_DIR}/*.profraw")
+	if(NOT raw_profiles)
+		message(FATAL_ERROR "The training run wrote no profiles to ${PGO_DIR}.")
+	endif()
+	execute_process(COMMAND "${MERGE_TOOL}" merge -output=${PGO_DIR}/sudoku.profdata ${raw_profiles} RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "Merging the profiles failed: ${result}")
+	endif()
+endif()
+message(STATUS "Profiles written to ${PGO_DIR}. Reconfigure with -DSUDOKU_PGO=USE and rebuild.")